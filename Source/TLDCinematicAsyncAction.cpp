@@ -0,0 +1,46 @@
+﻿// TLDCinematicAsyncAction.cpp
+#include "UI/TLDCinematicAsyncAction.h"
+#include "Engine/GameInstance.h"
+#include "Kismet/GameplayStatics.h"
+#include "UI/TLDCinematicManager.h"
+
+UTLDPlayCinematicAsyncAction* UTLDPlayCinematicAsyncAction::PlayCinematicByNameAsync(UObject* WorldContextObject, FName CinematicName,
+	bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay)
+{
+	UTLDPlayCinematicAsyncAction* Action = NewObject<UTLDPlayCinematicAsyncAction>();
+	Action->WorldContext = WorldContextObject;
+	Action->CinematicName = CinematicName;
+	Action->bPauseGame = bPauseGame;
+	Action->bSkippable = bSkippable;
+	Action->PreDelay = PreDelay;
+	Action->PostDelay = PostDelay;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UTLDPlayCinematicAsyncAction::Activate()
+{
+	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContext.Get());
+	UTLDCinematicManager* Manager = GameInstance ? GameInstance->GetSubsystem<UTLDCinematicManager>() : nullptr;
+	if (!Manager)
+	{
+		HandleRequestComplete(false);
+		return;
+	}
+
+	Manager->PlayCinematicByNameAsync(CinematicName, bPauseGame, bSkippable, PreDelay, PostDelay,
+		FTLDOnCinematicRequestComplete::CreateUObject(this, &UTLDPlayCinematicAsyncAction::HandleRequestComplete));
+}
+
+void UTLDPlayCinematicAsyncAction::HandleRequestComplete(bool bStarted)
+{
+	if (bStarted)
+	{
+		OnStarted.Broadcast();
+	}
+	else
+	{
+		OnFailed.Broadcast();
+	}
+	SetReadyToDestroy();
+}
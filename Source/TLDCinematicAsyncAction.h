@@ -0,0 +1,38 @@
+// TLDCinematicAsyncAction.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "TLDCinematicAsyncAction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FTLDCinematicAsyncActionPin);
+
+// Latent "Play Cinematic By Name (Async)" node: resolves and streams the sequence, then fires OnStarted or OnFailed
+UCLASS()
+class THELASTDROP_API UTLDPlayCinematicAsyncAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category="Cinematics", meta=(BlueprintInternalUseOnly="true", WorldContext="WorldContextObject", DisplayName="Play Cinematic By Name (Async)"))
+	static UTLDPlayCinematicAsyncAction* PlayCinematicByNameAsync(UObject* WorldContextObject, FName CinematicName,
+		bool bPauseGame = true, bool bSkippable = true, float PreDelay = 0.f, float PostDelay = 0.f);
+
+	UPROPERTY(BlueprintAssignable)
+	FTLDCinematicAsyncActionPin OnStarted;
+
+	UPROPERTY(BlueprintAssignable)
+	FTLDCinematicAsyncActionPin OnFailed;
+
+	virtual void Activate() override;
+
+private:
+	void HandleRequestComplete(bool bStarted);
+
+	TWeakObjectPtr<UObject> WorldContext;
+	FName CinematicName;
+	bool bPauseGame = true;
+	bool bSkippable = true;
+	float PreDelay = 0.f;
+	float PostDelay = 0.f;
+};
@@ -0,0 +1,292 @@
+﻿// TLDCinematicBenchmark.cpp
+#include "UI/TLDCinematicManager.h"
+#include "Containers/Ticker.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UI/TLDCinematicConfig.h"
+#include "UI/TLDCinematicDiagnostics.h"
+
+#if TLD_CINEMATIC_LATENCY_TRACKING
+
+DEFINE_LOG_CATEGORY_STATIC(LogTLDCinematicBenchmark, Log, All);
+
+// Plays every config entry through the manager, cold and/or warm, and writes one CSV row per run.
+// CI: -ExecCmds="tld.Cinematic.Benchmark quit baseline=<previous.csv>" exits non-zero when a run regresses.
+class FTLDCinematicBenchmark
+{
+public:
+	struct FResult
+	{
+		FName CinematicName;
+		bool bCold = false;
+		// Cold run whose assets another requester kept resident; it measured a warm start and is not compared
+		bool bPinned = false;
+		bool bStarted = false;
+		double LatencyMs = 0.0;
+		double HitchMs = 0.0;
+		double MemDeltaMB = 0.0;
+	};
+
+	FTLDCinematicBenchmark(UTLDCinematicManager& InManager, const TArray<FString>& Args)
+		: Manager(&InManager)
+	{
+		const bool bColdOnly = Args.Contains(TEXT("cold"));
+		const bool bWarmOnly = Args.Contains(TEXT("warm"));
+		bRunCold = bColdOnly || !bWarmOnly;
+		bRunWarm = bWarmOnly || !bColdOnly;
+		bQuitWhenDone = Args.Contains(TEXT("quit"));
+
+		for (const FString& Arg : Args)
+		{
+			FParse::Value(*Arg, TEXT("baseline="), BaselinePath);
+			FParse::Value(*Arg, TEXT("tolerance="), Tolerance);
+		}
+
+		if (TSharedPtr<const FTLDCinematicConfigSnapshot> Snapshot = InManager.GetConfigSnapshot())
+		{
+			for (const FName Name : Snapshot->GetNames())
+			{
+				if (!Name.IsNone())
+				{
+					Names.AddUnique(Name);
+				}
+			}
+		}
+	}
+
+	~FTLDCinematicBenchmark()
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	}
+
+	void Start()
+	{
+		UE_LOG(LogTLDCinematicBenchmark, Display, TEXT("Cinematic benchmark: %d cinematics, cold=%d warm=%d"), Names.Num(), bRunCold, bRunWarm);
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTLDCinematicBenchmark::Tick));
+	}
+
+	bool IsRunning() const { return TickHandle.IsValid(); }
+
+private:
+	enum class EStep : uint8
+	{
+		Prepare,
+		WaitForStart,
+		WaitForFirstFrame,
+		Settle
+	};
+
+	bool Tick(float DeltaTime)
+	{
+		UTLDCinematicManager* ManagerPtr = Manager.Get();
+		if (!ManagerPtr)
+		{
+			UE_LOG(LogTLDCinematicBenchmark, Error, TEXT("Cinematic benchmark aborted: manager went away"));
+			return Finish();
+		}
+
+		switch (Step)
+		{
+		case EStep::Prepare:
+			return Prepare(*ManagerPtr);
+
+		case EStep::WaitForStart:
+			// Loads are async, so the worst game-thread frame between request and start is the hitch
+			Current.HitchMs = FMath::Max(Current.HitchMs, DeltaTime * 1000.0);
+			return true;
+
+		case EStep::WaitForFirstFrame:
+			// Sequencer evaluates the first frame on the tick after Play()
+			Current.HitchMs = FMath::Max(Current.HitchMs, DeltaTime * 1000.0);
+			Current.MemDeltaMB = (static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) - MemoryBefore) / (1024.0 * 1024.0);
+			ManagerPtr->SkipCurrentCinematic();
+			Results.Add(Current);
+			Step = EStep::Settle;
+			return true;
+
+		case EStep::Settle:
+			Step = EStep::Prepare;
+			return true;
+		}
+		return true;
+	}
+
+	bool Prepare(UTLDCinematicManager& ManagerRef)
+	{
+		// Each name runs cold first, so the warm run reuses what the cold run made resident
+		const int32 RunsPerName = (bRunCold ? 1 : 0) + (bRunWarm ? 1 : 0);
+		if (RunIndex >= Names.Num() * RunsPerName)
+		{
+			return Finish();
+		}
+
+		Current = FResult();
+		Current.CinematicName = Names[RunIndex / RunsPerName];
+		Current.bCold = bRunCold && RunIndex % RunsPerName == 0;
+		++RunIndex;
+
+		if (Current.bCold)
+		{
+			// Not being resident is the cold case already; only a cinematic something else holds is measured warm
+			Current.bPinned = ManagerRef.EvictResidentCinematic(Current.CinematicName) == ETLDCinematicEvictResult::Held;
+			if (Current.bPinned)
+			{
+				UE_LOG(LogTLDCinematicBenchmark, Warning, TEXT("Cinematic benchmark: %s is held resident, cold run will be reported as pinned"),
+					*Current.CinematicName.ToString());
+			}
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+
+		MemoryBefore = static_cast<double>(FPlatformMemory::GetStats().UsedPhysical);
+		RequestTime = FPlatformTime::Seconds();
+		Step = EStep::WaitForStart;
+
+		const bool bAccepted = ManagerRef.PlayCinematicByNameAsync(Current.CinematicName, false, true, 0.f, 0.f,
+			FTLDOnCinematicRequestComplete::CreateRaw(this, &FTLDCinematicBenchmark::HandleStarted));
+		if (!bAccepted && Step == EStep::WaitForStart)
+		{
+			Results.Add(Current);
+			Step = EStep::Prepare;
+		}
+		return true;
+	}
+
+	void HandleStarted(bool bStarted)
+	{
+		if (Step != EStep::WaitForStart)
+		{
+			return;
+		}
+
+		Current.bStarted = bStarted;
+		Current.LatencyMs = (FPlatformTime::Seconds() - RequestTime) * 1000.0;
+		if (bStarted)
+		{
+			Step = EStep::WaitForFirstFrame;
+		}
+		else
+		{
+			Results.Add(Current);
+			Step = EStep::Prepare;
+		}
+	}
+
+	bool Finish()
+	{
+		TickHandle.Reset();
+
+		FString Csv = TEXT("Name,Cache,Started,LatencyMs,HitchMs,MemDeltaMB\n");
+		for (const FResult& Result : Results)
+		{
+			Csv += FString::Printf(TEXT("%s,%s,%d,%.2f,%.2f,%.2f\n"), *Result.CinematicName.ToString(),
+				GetCacheLabel(Result), Result.bStarted, Result.LatencyMs, Result.HitchMs, Result.MemDeltaMB);
+		}
+
+		const FString ReportPath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("TLDCinematics"),
+			FString::Printf(TEXT("StartLatency-%s.csv"), *FDateTime::Now().ToString()));
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(ReportPath), true);
+		FFileHelper::SaveStringToFile(Csv, *ReportPath);
+		UE_LOG(LogTLDCinematicBenchmark, Display, TEXT("Cinematic benchmark: %d runs written to %s"), Results.Num(), *ReportPath);
+
+		const int32 Regressions = CompareWithBaseline();
+		if (bQuitWhenDone)
+		{
+			FPlatformMisc::RequestExitWithStatus(false, Regressions > 0 ? 1 : 0);
+		}
+		return false;
+	}
+
+	static const TCHAR* GetCacheLabel(const FResult& Result)
+	{
+		return Result.bPinned ? TEXT("pinned") : Result.bCold ? TEXT("cold") : TEXT("warm");
+	}
+
+	int32 CompareWithBaseline() const
+	{
+		TArray<FString> Lines;
+		if (BaselinePath.IsEmpty() || !FFileHelper::LoadFileToStringArray(Lines, *BaselinePath))
+		{
+			return 0;
+		}
+
+		TMap<FString, double> BaselineMs;
+		for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+		{
+			TArray<FString> Columns;
+			if (Lines[LineIndex].ParseIntoArray(Columns, TEXT(",")) >= 4)
+			{
+				BaselineMs.Add(Columns[0] + TEXT(",") + Columns[1], FCString::Atod(*Columns[3]));
+			}
+		}
+
+		// A few ms of jitter is noise on small cinematics, so the ratio only counts past an absolute floor
+		int32 Regressions = 0;
+		for (const FResult& Result : Results)
+		{
+			if (Result.bPinned)
+			{
+				continue;
+			}
+
+			const double* Baseline = BaselineMs.Find(Result.CinematicName.ToString() + TEXT(",") + GetCacheLabel(Result));
+			if (Baseline && Result.LatencyMs > *Baseline * Tolerance && Result.LatencyMs - *Baseline > 5.0)
+			{
+				++Regressions;
+				UE_LOG(LogTLDCinematicBenchmark, Warning, TEXT("Cinematic start regression: %s (%s) %.1f ms, baseline %.1f ms"),
+					*Result.CinematicName.ToString(), GetCacheLabel(Result), Result.LatencyMs, *Baseline);
+			}
+		}
+		UE_LOG(LogTLDCinematicBenchmark, Display, TEXT("Cinematic benchmark: %d regressions against %s"), Regressions, *BaselinePath);
+		return Regressions;
+	}
+
+	TWeakObjectPtr<UTLDCinematicManager> Manager;
+	TArray<FName> Names;
+	TArray<FResult> Results;
+	FResult Current;
+	EStep Step = EStep::Prepare;
+	int32 RunIndex = 0;
+	double RequestTime = 0.0;
+	double MemoryBefore = 0.0;
+
+	bool bRunCold = true;
+	bool bRunWarm = true;
+	bool bQuitWhenDone = false;
+	FString BaselinePath;
+	double Tolerance = 1.25;
+
+	FTSTicker::FDelegateHandle TickHandle;
+};
+
+static TUniquePtr<FTLDCinematicBenchmark> GTLDCinematicBenchmark;
+
+static FAutoConsoleCommandWithWorldAndArgs GTLDCinematicBenchmarkCommand(
+	TEXT("tld.Cinematic.Benchmark"),
+	TEXT("Plays every config cinematic and writes start latency, hitch and memory delta to Saved/Profiling/TLDCinematics. ")
+	TEXT("Args: cold | warm (default both), baseline=<csv>, tolerance=<ratio, default 1.25>, quit."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		UTLDCinematicManager* Manager = GameInstance ? GameInstance->GetSubsystem<UTLDCinematicManager>() : nullptr;
+		if (!Manager || !Manager->IsConfigReady())
+		{
+			UE_LOG(LogTLDCinematicBenchmark, Error, TEXT("Cinematic benchmark needs a game world with the cinematic config loaded"));
+			return;
+		}
+
+		if (GTLDCinematicBenchmark && GTLDCinematicBenchmark->IsRunning())
+		{
+			UE_LOG(LogTLDCinematicBenchmark, Warning, TEXT("Cinematic benchmark already running"));
+			return;
+		}
+
+		GTLDCinematicBenchmark = MakeUnique<FTLDCinematicBenchmark>(*Manager, Args);
+		GTLDCinematicBenchmark->Start();
+	}));
+
+#endif
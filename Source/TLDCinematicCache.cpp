@@ -0,0 +1,137 @@
+﻿// TLDCinematicCache.cpp
+#include "UI/TLDCinematicCache.h"
+#include "Engine/StreamableManager.h"
+#include "LevelSequence.h"
+
+ULevelSequence* FTLDCinematicSequenceCache::Find(FName CinematicName)
+{
+	const int32 Index = Entries.IndexOfByPredicate([CinematicName](const FTLDCinematicCacheEntry& Entry)
+	{
+		return Entry.CinematicName == CinematicName;
+	});
+
+	if (Index == INDEX_NONE || !Entries[Index].Sequence)
+	{
+		++Misses;
+		return nullptr;
+	}
+
+	++Hits;
+	if (Index != Entries.Num() - 1)
+	{
+		FTLDCinematicCacheEntry Entry = Entries[Index];
+		Entries.RemoveAt(Index, 1, false);
+		Entries.Add(Entry);
+	}
+	return Entries.Last().Sequence;
+}
+
+void FTLDCinematicSequenceCache::Add(FName CinematicName, ULevelSequence* Sequence, int64 SizeBytes, TSharedPtr<FStreamableHandle> ManifestHandle)
+{
+	if (CinematicName.IsNone() || !Sequence)
+	{
+		return;
+	}
+
+	const int32 Existing = Entries.IndexOfByPredicate([CinematicName](const FTLDCinematicCacheEntry& Entry)
+	{
+		return Entry.CinematicName == CinematicName;
+	});
+	if (Existing != INDEX_NONE)
+	{
+		// The old handle is released after the new one is taken, so shared manifest assets never drop out in between
+		if (!ManifestHandle.IsValid())
+		{
+			ManifestHandle = MoveTemp(Entries[Existing].ManifestHandle);
+		}
+		RemoveEntryAt(Existing);
+	}
+
+	FTLDCinematicCacheEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.CinematicName = CinematicName;
+	Entry.Sequence = Sequence;
+	Entry.ManifestHandle = MoveTemp(ManifestHandle);
+	Entry.SizeBytes = SizeBytes > 0 ? SizeBytes : Sequence->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	ResidentBytes += Entry.SizeBytes;
+
+	Trim();
+}
+
+bool FTLDCinematicSequenceCache::Remove(FName CinematicName)
+{
+	if (Pins.Contains(CinematicName))
+	{
+		return false;
+	}
+
+	const int32 Index = Entries.IndexOfByPredicate([CinematicName](const FTLDCinematicCacheEntry& Entry)
+	{
+		return Entry.CinematicName == CinematicName;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	RemoveEntryAt(Index);
+	return true;
+}
+
+void FTLDCinematicSequenceCache::Pin(FName CinematicName)
+{
+	++Pins.FindOrAdd(CinematicName);
+}
+
+void FTLDCinematicSequenceCache::Unpin(FName CinematicName)
+{
+	if (int32* Count = Pins.Find(CinematicName))
+	{
+		if (--(*Count) <= 0)
+		{
+			Pins.Remove(CinematicName);
+			Trim();
+		}
+	}
+}
+
+void FTLDCinematicSequenceCache::SetBudgetBytes(int64 InBudgetBytes)
+{
+	BudgetBytes = FMath::Max<int64>(0, InBudgetBytes);
+	Trim();
+}
+
+void FTLDCinematicSequenceCache::Reset()
+{
+	while (Entries.Num() > 0)
+	{
+		RemoveEntryAt(Entries.Num() - 1);
+	}
+	Pins.Reset();
+	ResidentBytes = 0;
+}
+
+void FTLDCinematicSequenceCache::Trim()
+{
+	// Never evict the most recent entry: it is the one that was just played or prefetched
+	for (int32 Index = 0; ResidentBytes > BudgetBytes && Index < Entries.Num() - 1;)
+	{
+		if (Pins.Contains(Entries[Index].CinematicName))
+		{
+			++Index;
+			continue;
+		}
+
+		RemoveEntryAt(Index);
+	}
+}
+
+void FTLDCinematicSequenceCache::RemoveEntryAt(int32 Index)
+{
+	FTLDCinematicCacheEntry& Entry = Entries[Index];
+	if (Entry.ManifestHandle.IsValid())
+	{
+		Entry.ManifestHandle->ReleaseHandle();
+	}
+	ResidentBytes -= Entry.SizeBytes;
+	Entries.RemoveAt(Index, 1, false);
+}
@@ -0,0 +1,67 @@
+// TLDCinematicCache.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TLDCinematicCache.generated.h"
+
+class ULevelSequence;
+struct FStreamableHandle;
+
+USTRUCT()
+struct FTLDCinematicCacheEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	ULevelSequence* Sequence = nullptr;
+
+	// Keeps the entry's preload manifest resident with it, so a cache hit starts without first-evaluation loads
+	TSharedPtr<FStreamableHandle> ManifestHandle;
+
+	FName CinematicName;
+	int64 SizeBytes = 0;
+};
+
+// Resident set of resolved sequences, LRU-evicted against a byte budget.
+// Entries are kept in recency order: front is least recently used, back is most recent.
+USTRUCT()
+struct THELASTDROP_API FTLDCinematicSequenceCache
+{
+	GENERATED_BODY()
+
+	// Returns the cached sequence and marks it most recently used
+	ULevelSequence* Find(FName CinematicName);
+
+	// Inserts or refreshes an entry, then evicts down to budget. SizeBytes 0 estimates from the sequence's resource size.
+	// A refresh without a ManifestHandle keeps the one the entry already holds.
+	void Add(FName CinematicName, ULevelSequence* Sequence, int64 SizeBytes = 0, TSharedPtr<FStreamableHandle> ManifestHandle = nullptr);
+
+	// Drops an unpinned entry; returns false when it was not resident or is pinned
+	bool Remove(FName CinematicName);
+
+	// Pins are counted and may be taken before the sequence is resident
+	void Pin(FName CinematicName);
+	void Unpin(FName CinematicName);
+	bool IsPinned(FName CinematicName) const { return Pins.Contains(CinematicName); }
+
+	void SetBudgetBytes(int64 InBudgetBytes);
+	void Reset();
+
+	int32 Num() const { return Entries.Num(); }
+	int64 GetResidentBytes() const { return ResidentBytes; }
+	uint32 GetHits() const { return Hits; }
+	uint32 GetMisses() const { return Misses; }
+
+private:
+	void Trim();
+	void RemoveEntryAt(int32 Index);
+
+	UPROPERTY(Transient)
+	TArray<FTLDCinematicCacheEntry> Entries;
+
+	TMap<FName, int32> Pins;
+	int64 BudgetBytes = 0;
+	int64 ResidentBytes = 0;
+	uint32 Hits = 0;
+	uint32 Misses = 0;
+};
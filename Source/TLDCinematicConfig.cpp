@@ -1,14 +1,357 @@
 ﻿// TLDCinematicConfig.cpp
 #include "UI/TLDCinematicConfig.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/ObjectSaveContext.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogTLDCinematicConfig, Log, All);
 
 ULevelSequence* UTLDCinematicConfig::GetSequenceByName(const FString& CinematicName) const
 {
-	for (const FTLDCinematicEntry& Entry : Cinematics)
+	// FNAME_Find: unknown names resolve to NAME_None instead of growing the name table
+	return GetSequenceByFName(FName(*CinematicName, FNAME_Find));
+}
+
+ULevelSequence* UTLDCinematicConfig::GetSequenceByFName(FName CinematicName) const
+{
+	const FTLDCinematicEntry* Entry = FindEntry(CinematicName);
+	if (Entry && Entry->Sequence.ToSoftObjectPath().IsValid())
+	{
+		return Entry->Sequence.LoadSynchronous();
+	}
+	return nullptr;
+}
+
+const FTLDCinematicEntry* UTLDCinematicConfig::FindEntry(FName CinematicName) const
+{
+	if (CinematicName.IsNone())
+	{
+		return nullptr;
+	}
+
+	const int32 Index = FindEntryIndex(CinematicName);
+	return Index != INDEX_NONE ? &Cinematics[Index] : nullptr;
+}
+
+int32 UTLDCinematicConfig::FindEntryIndex(FName CinematicName) const
+{
+	if (CinematicName.IsNone())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32* Index = NameToIndex.Find(CinematicName);
+	return Index ? *Index : INDEX_NONE;
+}
+
+const FTLDCinematicEntry* UTLDCinematicConfig::FindEntry(FName CinematicName, int32 IndexHint) const
+{
+	if (EntryNames.IsValidIndex(IndexHint) && EntryNames[IndexHint] == CinematicName && !CinematicName.IsNone())
+	{
+		return &Cinematics[IndexHint];
+	}
+	return FindEntry(CinematicName);
+}
+
+void UTLDCinematicConfig::FindShardsForLevel(FName LevelPackage, TArray<FSoftObjectPath>& OutShards)
+{
+	if (LevelPackage.IsNone())
 	{
-		if (Entry.CinematicName == CinematicName && Entry.Sequence.ToSoftObjectPath().IsValid())
+		return;
+	}
+
+	// The tag holds the world's object path; matching it in the filter keeps streaming cells from scanning every config
+	const FName ShardLevelTag = GET_MEMBER_NAME_CHECKED(UTLDCinematicConfig, ShardLevel);
+	const FString LevelPath = LevelPackage.ToString();
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UTLDCinematicConfig::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.TagsAndValues.Add(ShardLevelTag, FString::Printf(TEXT("%s.%s"), *LevelPath, *FPackageName::GetShortName(LevelPath)));
+
+	TArray<FAssetData> Assets;
+	IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+
+	for (const FAssetData& Asset : Assets)
+	{
+		FString ShardLevelPath;
+		if (Asset.GetTagValue(ShardLevelTag, ShardLevelPath) && !ShardLevelPath.IsEmpty()
+			&& FSoftObjectPath(ShardLevelPath).GetLongPackageFName() == LevelPackage)
 		{
-			return Entry.Sequence.LoadSynchronous();
+			OutShards.Add(Asset.GetSoftObjectPath());
 		}
 	}
-	return nullptr;
+}
+
+FPrimaryAssetId UTLDCinematicConfig::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(TEXT("TLDCinematicConfig"), GetFName());
+}
+
+void UTLDCinematicConfig::PostLoad()
+{
+	Super::PostLoad();
+	RebuildNameIndex();
+}
+
+void UTLDCinematicConfig::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+#if WITH_EDITOR
+	// Cooks rebuild too, so a sequence edited after the config was last saved still ships an accurate manifest
+	RebuildPreloadManifests();
+#endif
+}
+
+#if WITH_EDITOR
+static void GatherPreloadManifest(const IAssetRegistry& AssetRegistry, const FSoftObjectPath& Root, TArray<FSoftObjectPath>& OutAssets, int64& OutBytes)
+{
+	using namespace UE::AssetRegistry;
+
+	const FName RootPackage = Root.GetLongPackageFName();
+	const FTopLevelAssetPath WorldClass = UWorld::StaticClass()->GetClassPathName();
+	TSet<FName> Visited;
+	Visited.Add(RootPackage);
+
+	// Soft references stop after one hop (a soft ref to a map or another cinematic must not pull in its whole closure).
+	// Game only: editor-only packages are not cooked, and requesting them would stall the preload.
+	TArray<FName> Pending;
+	AssetRegistry.GetDependencies(RootPackage, Pending, EDependencyCategory::Package, EDependencyQuery::Game);
+
+	TArray<FName> PackageOrder;
+	PackageOrder.Add(RootPackage);
+	while (Pending.Num() > 0)
+	{
+		const FName Package = Pending.Pop(false);
+		bool bAlreadyVisited = false;
+		Visited.Add(Package, &bAlreadyVisited);
+		if (bAlreadyVisited || Package.ToString().StartsWith(TEXT("/Script/")))
+		{
+			continue;
+		}
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByPackageName(Package, Assets);
+		if (Assets.Num() == 0 || Assets.ContainsByPredicate([&WorldClass](const FAssetData& Asset) { return Asset.AssetClassPath == WorldClass; }))
+		{
+			continue;
+		}
+
+		for (const FAssetData& Asset : Assets)
+		{
+			OutAssets.Add(Asset.GetSoftObjectPath());
+		}
+		PackageOrder.Add(Package);
+		AssetRegistry.GetDependencies(Package, Pending, EDependencyCategory::Package, EDependencyQuery::Hard | EDependencyQuery::Game);
+	}
+
+	for (const FName Package : PackageOrder)
+	{
+		if (const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Package))
+		{
+			OutBytes += FMath::Max<int64>(0, PackageData->DiskSize);
+		}
+	}
+}
+
+void UTLDCinematicConfig::RebuildPreloadManifests()
+{
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		UE_LOG(LogTLDCinematicConfig, Warning, TEXT("%s: Asset Registry still scanning, preload manifests left as they were"), *GetName());
+		return;
+	}
+
+	for (FTLDCinematicEntry& Entry : Cinematics)
+	{
+		Entry.PreloadAssets.Reset();
+		Entry.PreloadBytes = 0;
+
+		const TSoftObjectPtr<ULevelSequence>& Start = Entry.Sections.Num() > 0 ? Entry.Sections[0] : Entry.Sequence;
+		if (!Start.IsNull())
+		{
+			GatherPreloadManifest(AssetRegistry, Start.ToSoftObjectPath(), Entry.PreloadAssets, Entry.PreloadBytes);
+		}
+	}
+}
+
+void UTLDCinematicConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	RebuildNameIndex();
+}
+
+EDataValidationResult UTLDCinematicConfig::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+
+	TSet<FName> Seen;
+	for (int32 Index = 0; Index < Cinematics.Num(); ++Index)
+	{
+		const FTLDCinematicEntry& Entry = Cinematics[Index];
+		if (Entry.CinematicName.IsEmpty())
+		{
+			Context.AddError(FText::FromString(FString::Printf(TEXT("Cinematics[%d] has an empty CinematicName"), Index)));
+			Result = EDataValidationResult::Invalid;
+			continue;
+		}
+
+		bool bAlreadySeen = false;
+		Seen.Add(FName(*Entry.CinematicName), &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			Context.AddError(FText::FromString(FString::Printf(TEXT("Duplicate CinematicName '%s' at Cinematics[%d]"), *Entry.CinematicName, Index)));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		// Sectioned entries play from Sections[0], so the whole-sequence slot may stay empty
+		if (Entry.Sequence.IsNull() && Entry.Sections.Num() == 0)
+		{
+			Context.AddError(FText::FromString(FString::Printf(TEXT("'%s' has neither a Sequence nor Sections assigned"), *Entry.CinematicName)));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		for (int32 Section = 0; Section < Entry.Sections.Num(); ++Section)
+		{
+			if (Entry.Sections[Section].IsNull())
+			{
+				Context.AddError(FText::FromString(FString::Printf(TEXT("'%s' Sections[%d] is empty"), *Entry.CinematicName, Section)));
+				Result = EDataValidationResult::Invalid;
+			}
+		}
+	}
+
+	return Result == EDataValidationResult::NotValidated ? EDataValidationResult::Valid : Result;
+}
+#endif
+
+void UTLDCinematicConfig::RebuildNameIndex()
+{
+	NameToIndex.Reset();
+	NameToIndex.Reserve(Cinematics.Num());
+	EntryNames.Reset(Cinematics.Num());
+
+	for (int32 Index = 0; Index < Cinematics.Num(); ++Index)
+	{
+		const FString& Name = Cinematics[Index].CinematicName;
+		const FName EntryName = Name.IsEmpty() ? NAME_None : FName(*Name);
+		EntryNames.Add(EntryName);
+
+		if (!EntryName.IsNone())
+		{
+			// First entry wins on duplicates, matching the old linear scan
+			NameToIndex.FindOrAdd(EntryName, Index);
+		}
+	}
+}
+
+TSharedRef<const FTLDCinematicConfigSnapshot> FTLDCinematicConfigSnapshot::Build(const UTLDCinematicConfig& Config)
+{
+	const UTLDCinematicConfig* const Configs[] = { &Config };
+	return Build(Configs);
+}
+
+TSharedRef<const FTLDCinematicConfigSnapshot> FTLDCinematicConfigSnapshot::Build(TArrayView<const UTLDCinematicConfig* const> Configs)
+{
+	int32 TotalEntries = 0;
+	for (const UTLDCinematicConfig* Config : Configs)
+	{
+		TotalEntries += Config ? Config->Cinematics.Num() : 0;
+	}
+
+	TSharedRef<FTLDCinematicConfigSnapshot> Snapshot = MakeShared<FTLDCinematicConfigSnapshot>();
+	Snapshot->Names.Reserve(TotalEntries);
+	Snapshot->Sequences.Reserve(TotalEntries);
+	Snapshot->NameToIndex.Reserve(TotalEntries);
+	Snapshot->SectionStarts.Reserve(TotalEntries + 1);
+	Snapshot->PreloadStarts.Reserve(TotalEntries + 1);
+	Snapshot->PreloadBytes.Reserve(TotalEntries);
+
+	for (const UTLDCinematicConfig* Config : Configs)
+	{
+		if (!Config)
+		{
+			continue;
+		}
+
+		for (const FTLDCinematicEntry& Entry : Config->Cinematics)
+		{
+			const FName Name(*Entry.CinematicName);
+			const int32 Index = Snapshot->Names.Add(Name);
+			Snapshot->Sequences.Add(Entry.Sequence);
+			Snapshot->SectionStarts.Add(Snapshot->SectionSequences.Num());
+			Snapshot->SectionSequences.Append(Entry.Sections);
+			Snapshot->PreloadStarts.Add(Snapshot->PreloadPaths.Num());
+			Snapshot->PreloadPaths.Append(Entry.PreloadAssets);
+			Snapshot->PreloadBytes.Add(Entry.PreloadBytes);
+			if (!Name.IsNone())
+			{
+				Snapshot->NameToIndex.FindOrAdd(Name, Index);
+			}
+		}
+	}
+	Snapshot->SectionStarts.Add(Snapshot->SectionSequences.Num());
+	Snapshot->PreloadStarts.Add(Snapshot->PreloadPaths.Num());
+	return Snapshot;
+}
+
+const TSoftObjectPtr<ULevelSequence>* FTLDCinematicConfigSnapshot::FindSequence(FName CinematicName, int32 IndexHint) const
+{
+	if (CinematicName.IsNone())
+	{
+		return nullptr;
+	}
+
+	const int32 Index = ResolveIndex(CinematicName, IndexHint);
+	return Index != INDEX_NONE ? &Sequences[Index] : nullptr;
+}
+
+int32 FTLDCinematicConfigSnapshot::ResolveIndex(FName CinematicName, int32 IndexHint) const
+{
+	if (Names.IsValidIndex(IndexHint) && Names[IndexHint] == CinematicName && !CinematicName.IsNone())
+	{
+		return IndexHint;
+	}
+	return FindIndex(CinematicName);
+}
+
+TArrayView<const TSoftObjectPtr<ULevelSequence>> FTLDCinematicConfigSnapshot::FindSections(FName CinematicName, int32 IndexHint) const
+{
+	const int32 Index = ResolveIndex(CinematicName, IndexHint);
+	if (Index == INDEX_NONE)
+	{
+		return TArrayView<const TSoftObjectPtr<ULevelSequence>>();
+	}
+
+	const int32 Start = SectionStarts[Index];
+	return TArrayView<const TSoftObjectPtr<ULevelSequence>>(SectionSequences.GetData() + Start, SectionStarts[Index + 1] - Start);
+}
+
+TArrayView<const FSoftObjectPath> FTLDCinematicConfigSnapshot::FindPreloadAssets(FName CinematicName, int32 IndexHint) const
+{
+	const int32 Index = ResolveIndex(CinematicName, IndexHint);
+	if (Index == INDEX_NONE)
+	{
+		return TArrayView<const FSoftObjectPath>();
+	}
+
+	const int32 Start = PreloadStarts[Index];
+	return TArrayView<const FSoftObjectPath>(PreloadPaths.GetData() + Start, PreloadStarts[Index + 1] - Start);
+}
+
+int64 FTLDCinematicConfigSnapshot::GetPreloadBytes(FName CinematicName, int32 IndexHint) const
+{
+	const int32 Index = ResolveIndex(CinematicName, IndexHint);
+	return Index != INDEX_NONE ? PreloadBytes[Index] : 0;
+}
+
+int32 FTLDCinematicConfigSnapshot::FindIndex(FName CinematicName) const
+{
+	const int32* Index = CinematicName.IsNone() ? nullptr : NameToIndex.Find(CinematicName);
+	return Index ? *Index : INDEX_NONE;
 }
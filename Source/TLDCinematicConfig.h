@@ -6,6 +6,9 @@
 #include "LevelSequence.h"
 #include "TLDCinematicConfig.generated.h"
 
+class FObjectPreSaveContext;
+class UWorld;
+
 USTRUCT(BlueprintType)
 struct FTLDCinematicEntry
 {
@@ -16,6 +19,22 @@ struct FTLDCinematicEntry
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic", meta=(AllowedClasses="LevelSequence"))
 	TSoftObjectPtr<ULevelSequence> Sequence;
+
+	// Optional split of a long Sequence into consecutive sections. Story plays by name then stream section by section:
+	// playback starts once the first section is resident, the next one loads while the current plays, and played ones are released.
+	// Playlists and ambient plays still use Sequence.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic", meta=(AllowedClasses="LevelSequence"))
+	TArray<TSoftObjectPtr<ULevelSequence>> Sections;
+
+	// Generated on save from the Asset Registry for the start sequence (Sections[0] when sectioned): its direct soft references,
+	// which Sequencer would otherwise resolve on first evaluation, and hard references followed transitively.
+	// Streamed in the same async request as the sequence.
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category="Cinematic|Preload")
+	TArray<FSoftObjectPath> PreloadAssets;
+
+	// Disk size of the start sequence plus PreloadAssets; the resident cache budgets with it
+	UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category="Cinematic|Preload", meta=(Units="Bytes"))
+	int64 PreloadBytes = 0;
 };
 
 UCLASS(BlueprintType)
@@ -27,6 +46,88 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematics")
 	TArray<FTLDCinematicEntry> Cinematics;
 
+	// Set on shard configs: mounted by the manager while this level (persistent or streamed) is loaded.
+	// Left empty on the root config referenced from Project Settings. Searchable, so shards are found without loading them.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, AssetRegistrySearchable, Category="Cinematics")
+	TSoftObjectPtr<UWorld> ShardLevel;
+
+	// Asset Registry query for shard configs whose ShardLevel is LevelPackage (long package name, no PIE prefix)
+	static void FindShardsForLevel(FName LevelPackage, TArray<FSoftObjectPath>& OutShards);
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
 	UFUNCTION(BlueprintPure, Category="Cinematics")
 	ULevelSequence* GetSequenceByName(const FString& CinematicName) const;
+
+	// O(1) lookup through the transient name index
+	UFUNCTION(BlueprintPure, Category="Cinematics")
+	ULevelSequence* GetSequenceByFName(FName CinematicName) const;
+
+	const FTLDCinematicEntry* FindEntry(FName CinematicName) const;
+	int32 FindEntryIndex(FName CinematicName) const;
+	bool HasCinematic(FName CinematicName) const { return FindEntry(CinematicName) != nullptr; }
+
+	// Baked-ID path: a matching IndexHint resolves with a single FName compare, a stale one falls back to the index
+	const FTLDCinematicEntry* FindEntry(FName CinematicName, int32 IndexHint) const;
+
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+
+	// Recomputes every entry's PreloadAssets/PreloadBytes; also runs on save and cook
+	UFUNCTION(CallInEditor, Category="Cinematics")
+	void RebuildPreloadManifests();
+#endif
+
+private:
+	void RebuildNameIndex();
+
+	// Name -> index into Cinematics. FName compares are case-insensitive, same as the old FString scan.
+	TMap<FName, int32> NameToIndex;
+
+	// Parallel to Cinematics, so IndexHint checks never touch the FString
+	TArray<FName> EntryNames;
+};
+
+// Immutable runtime view of a UTLDCinematicConfig: names and sequence paths indexed once, then shared read-only.
+// The manager publishes one when its startup load completes; later asset edits need a new snapshot.
+struct THELASTDROP_API FTLDCinematicConfigSnapshot
+{
+	static TSharedRef<const FTLDCinematicConfigSnapshot> Build(const UTLDCinematicConfig& Config);
+
+	// Root first, so indices baked against the root config stay valid; earlier configs win duplicate names
+	static TSharedRef<const FTLDCinematicConfigSnapshot> Build(TArrayView<const UTLDCinematicConfig* const> Configs);
+
+	// Same hint semantics as UTLDCinematicConfig::FindEntry; nullptr for unknown names
+	const TSoftObjectPtr<ULevelSequence>* FindSequence(FName CinematicName, int32 IndexHint = INDEX_NONE) const;
+	int32 FindIndex(FName CinematicName) const;
+
+	// Empty unless the entry is sectioned
+	TArrayView<const TSoftObjectPtr<ULevelSequence>> FindSections(FName CinematicName, int32 IndexHint = INDEX_NONE) const;
+
+	// The entry's preload manifest, and its byte size (0 when no manifest was generated)
+	TArrayView<const FSoftObjectPath> FindPreloadAssets(FName CinematicName, int32 IndexHint = INDEX_NONE) const;
+	int64 GetPreloadBytes(FName CinematicName, int32 IndexHint = INDEX_NONE) const;
+	bool HasCinematic(FName CinematicName) const { return FindIndex(CinematicName) != INDEX_NONE; }
+
+	int32 Num() const { return Names.Num(); }
+	const TArray<FName>& GetNames() const { return Names; }
+
+private:
+	int32 ResolveIndex(FName CinematicName, int32 IndexHint) const;
+
+	TArray<FName> Names;
+	TArray<TSoftObjectPtr<ULevelSequence>> Sequences;
+	TMap<FName, int32> NameToIndex;
+
+	// Entry I's sections are SectionSequences[SectionStarts[I], SectionStarts[I + 1])
+	TArray<TSoftObjectPtr<ULevelSequence>> SectionSequences;
+	TArray<int32> SectionStarts;
+
+	// Same layout for the preload manifests
+	TArray<FSoftObjectPath> PreloadPaths;
+	TArray<int32> PreloadStarts;
+	TArray<int64> PreloadBytes;
 };
\ No newline at end of file
@@ -0,0 +1,33 @@
+﻿// TLDCinematicDiagnostics.cpp
+#include "UI/TLDCinematicDiagnostics.h"
+#include "HAL/IConsoleManager.h"
+
+#if TLD_PRESENTATION_ENABLED
+static TAutoConsoleVariable<int32> CVarTLDCinematicPresentation(
+	TEXT("tld.Cinematic.Presentation"),
+	1,
+	TEXT("Emit TLD presentation instrumentation from the cinematic pipeline. 0 = off, 1 = on."),
+	ECVF_Default);
+
+bool TLDCinematicDiagnostics::IsPresentationEnabled()
+{
+	return CVarTLDCinematicPresentation.GetValueOnGameThread() != 0;
+}
+#endif
+
+DEFINE_STAT(STAT_TLDCinematic_ConfigResolve);
+DEFINE_STAT(STAT_TLDCinematic_PlayerSpawn);
+DEFINE_STAT(STAT_TLDCinematic_Play);
+DEFINE_STAT(STAT_TLDCinematic_DeferredRelease);
+DEFINE_STAT(STAT_TLDCinematic_LastLoadMs);
+DEFINE_STAT(STAT_TLDCinematic_LastStartMs);
+DEFINE_STAT(STAT_TLDCinematic_CacheHits);
+DEFINE_STAT(STAT_TLDCinematic_CacheMisses);
+DEFINE_STAT(STAT_TLDCinematic_CacheResident);
+DEFINE_STAT(STAT_TLDCinematic_CacheBytes);
+DEFINE_STAT(STAT_TLDCinematic_PooledActors);
+DEFINE_STAT(STAT_TLDCinematic_QueuedRequests);
+DEFINE_STAT(STAT_TLDCinematic_AmbientSlots);
+DEFINE_STAT(STAT_TLDCinematic_DeferredReleases);
+
+UE_TRACE_CHANNEL_DEFINE(TLDCinematicChannel);
@@ -0,0 +1,64 @@
+// TLDCinematicDiagnostics.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Utilities/TLDPresentationDebugSystem.h"
+
+// Presentation instrumentation is compiled out of Shipping/Test. Add TLD_PRESENTATION_ENABLED=1 to the
+// module's PublicDefinitions to keep it in those configurations, still gated by tld.Cinematic.Presentation.
+#ifndef TLD_PRESENTATION_ENABLED
+	#define TLD_PRESENTATION_ENABLED !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+#if TLD_PRESENTATION_ENABLED
+namespace TLDCinematicDiagnostics
+{
+	THELASTDROP_API bool IsPresentationEnabled();
+}
+
+// Arguments expand inside the branch, so Printf and GetName only run when the CVar is on
+#define TLD_CINEMATIC_PRESENTATION(PresentationMacro, ...) \
+	do { if (TLDCinematicDiagnostics::IsPresentationEnabled()) { PresentationMacro(__VA_ARGS__); } } while (0)
+#else
+#define TLD_CINEMATIC_PRESENTATION(PresentationMacro, ...) do { } while (0)
+#endif
+
+#define TLD_CINEMATIC_ARCHITECTURE(...) TLD_CINEMATIC_PRESENTATION(TLD_PRESENTATION_ARCHITECTURE, __VA_ARGS__)
+#define TLD_CINEMATIC_DESIGNER(...)     TLD_CINEMATIC_PRESENTATION(TLD_PRESENTATION_DESIGNER, __VA_ARGS__)
+#define TLD_CINEMATIC_INTEGRATION(...)  TLD_CINEMATIC_PRESENTATION(TLD_PRESENTATION_INTEGRATION, __VA_ARGS__)
+#define TLD_CINEMATIC_TECHNICAL(...)    TLD_CINEMATIC_PRESENTATION(TLD_PRESENTATION_TECHNICAL, __VA_ARGS__)
+
+// Runtime content checks (trigger name validation) only exist in editor and development builds
+#define TLD_CINEMATIC_RUNTIME_VALIDATION !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+// `stat TLDCinematics` shows the live counters; run with -trace=cpu,TLDCinematic to get the pipeline scopes in Insights
+DECLARE_STATS_GROUP(TEXT("TLD Cinematics"), STATGROUP_TLDCinematics, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Config Resolve"), STAT_TLDCinematic_ConfigResolve, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Player Spawn"), STAT_TLDCinematic_PlayerSpawn, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Play"), STAT_TLDCinematic_Play, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Deferred Release"), STAT_TLDCinematic_DeferredRelease, STATGROUP_TLDCinematics, THELASTDROP_API);
+
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Sequence Load (ms)"), STAT_TLDCinematic_LastLoadMs, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Request To Play (ms)"), STAT_TLDCinematic_LastStartMs, STATGROUP_TLDCinematics, THELASTDROP_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cache Hits"), STAT_TLDCinematic_CacheHits, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cache Misses"), STAT_TLDCinematic_CacheMisses, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cache Resident"), STAT_TLDCinematic_CacheResident, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Cache Resident Bytes"), STAT_TLDCinematic_CacheBytes, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Actors"), STAT_TLDCinematic_PooledActors, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Queued Requests"), STAT_TLDCinematic_QueuedRequests, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Ambient Playing"), STAT_TLDCinematic_AmbientSlots, STATGROUP_TLDCinematics, THELASTDROP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Deferred Releases"), STAT_TLDCinematic_DeferredReleases, STATGROUP_TLDCinematics, THELASTDROP_API);
+
+UE_TRACE_CHANNEL_EXTERN(TLDCinematicChannel, THELASTDROP_API);
+
+// Cycle stat plus a CPU scope on the TLDCinematic trace channel, so Insights can isolate the pipeline
+#define TLD_CINEMATIC_SCOPE(StatId, TraceName) \
+	SCOPE_CYCLE_COUNTER(StatId); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("TLDCinematic::" TraceName, TLDCinematicChannel)
+
+// Per-name request-to-play latency kept for tld.Cinematic.DumpLatency; stripped from Shipping with the stats
+#define TLD_CINEMATIC_LATENCY_TRACKING !UE_BUILD_SHIPPING
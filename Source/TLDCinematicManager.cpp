@@ -1,203 +1,2418 @@
 ﻿#include "UI/TLDCinematicManager.h"
+#include "Async/Async.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
 #include "Engine/World.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "LevelSequence.h"
 #include "LevelSequenceActor.h"
 #include "MovieSceneSequencePlayer.h"
+#include "ProfilingDebugging/MiscTrace.h"
 #include "UI/TLDCinematicConfig.h"
+#include "UI/TLDCinematicDiagnostics.h"
+#include "UI/TLDCinematicNetComponent.h"
+#include "UI/TLDCinematicReplicator.h"
+#include "UI/TLDCinematicSettings.h"
 #include "Utilities/TLDProjectSettings.h"
-#include "Utilities/TLDPresentationDebugSystem.h"
 
-void UTLDCinematicManager::PlaySequence(ULevelSequence* Sequence, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay)
+DEFINE_LOG_CATEGORY_STATIC(LogTLDCinematicManager, Log, All);
+
+#if TLD_CINEMATIC_LATENCY_TRACKING
+static FAutoConsoleCommandWithWorldAndArgs GTLDCinematicDumpLatencyCommand(
+	TEXT("tld.Cinematic.DumpLatency"),
+	TEXT("Logs request-to-play latency per cinematic name, worst first. Pass 'reset' to clear it afterwards."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		if (UTLDCinematicManager* Manager = GameInstance ? GameInstance->GetSubsystem<UTLDCinematicManager>() : nullptr)
+		{
+			Manager->DumpStartLatencies(Args.Contains(TEXT("reset")));
+		}
+	}));
+#endif
+
+// Below this many entries the index is built inline; the worker round trip would cost the first request a frame
+static constexpr int32 TLDAsyncSnapshotMinEntries = 256;
+
+static FMovieSceneSequencePlaybackSettings MakeCinematicPlaybackSettings(ETLDCinematicLayer Layer = ETLDCinematicLayer::Story)
 {
-	if (!Sequence || !GetWorld())
+	// Ambient sequences play over gameplay, so only story cinematics take input away
+	const bool bExclusive = Layer == ETLDCinematicLayer::Story;
+	FMovieSceneSequencePlaybackSettings Settings;
+	Settings.bDisableLookAtInput = bExclusive;
+	Settings.bDisableMovementInput = bExclusive;
+	Settings.bHideHud = false;
+	return Settings;
+}
+
+// Issued even when everything is already resident, so the handle holds the preload manifest for as long as the caller keeps it.
+// A request that is complete on issue runs OnLoaded now instead of a frame later through the streamable manager.
+static void RequestSequenceLoad(TSharedPtr<FStreamableHandle>& OutHandle, TArray<FSoftObjectPath>&& Paths, FStreamableDelegate&& OnLoaded,
+	TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority)
+{
+	OutHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths), FStreamableDelegate(), Priority);
+	if (OutHandle.IsValid() && !OutHandle->HasLoadCompleted())
 	{
-		TLD_PRESENTATION_ARCHITECTURE(this, TEXT("Cinematic Manager"), 
-			TEXT("Plays cutscenes â†’ Controls game pause â†’ Handles skipping"), 
-			TEXT("System validation â†’ Prevents crashes"));
+		OutHandle->BindCompleteDelegate(MoveTemp(OnLoaded));
 		return;
 	}
+	OnLoaded.ExecuteIfBound();
+}
+
+void UTLDCinematicManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const UTLDCinematicSettings* Settings = UTLDCinematicSettings::Get();
+	SequenceCache.SetBudgetBytes(static_cast<int64>(Settings->ResidentCacheBudgetMB) * 1024 * 1024);
+
+	// Start the one config load now, while the game instance boots, so the first request rarely has to wait
+	RequestConfig(FSimpleDelegate());
+
+	WorldInitializedActorsHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UTLDCinematicManager::OnWorldInitializedActors);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UTLDCinematicManager::OnWorldCleanup);
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UTLDCinematicManager::OnLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UTLDCinematicManager::OnLevelRemovedFromWorld);
+	PostLoginHandle = FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &UTLDCinematicManager::OnGameModePostLogin);
+}
+
+void UTLDCinematicManager::Deinitialize()
+{
+	FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitializedActorsHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FGameModeEvents::GameModePostLoginEvent.Remove(PostLoginHandle);
+
+	StopAllAmbientCinematics();
+	FlushDeferredReleases();
 
-	if (bIsPlaying)
+	for (FTLDCinematicRequest& Queued : RequestQueue)
 	{
-		TLD_PRESENTATION_DESIGNER(this, TEXT("Single Playback"), 
-			TEXT("One cinematic at a time"), 
-			TEXT("Prevents conflicts â†’ Clean experience"));
-		return;
+		BroadcastRequestComplete(Queued, false);
 	}
+	RequestQueue.Reset();
+	QueuedPrefetchName = NAME_None;
 
-	TLD_PRESENTATION_DESIGNER(this, TEXT("Cutscene Request"), 
-		FString::Printf(TEXT("%s â†’ Pause:%s Skip:%s"), *Sequence->GetName(), 
-			bPauseGame ? TEXT("Y") : TEXT("N"), bSkippable ? TEXT("Y") : TEXT("N")), 
-		TEXT("Designer controls â†’ Blueprint callable"));
-
-	PendingSequence = Sequence;
-	bPendingPause = bPauseGame;
-	bPendingSkippable = bSkippable;
-	PendingPostDelay = FMath::Max(0.f, PostDelay);
-	bIsPlaying = true;
-	bAllowSkip = false;
+	for (TPair<FName, FPrefetchRecord>& Pair : Prefetches)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->CancelHandle();
+		}
+	}
+	Prefetches.Reset();
+	SequenceCache.Reset();
 
-	if (PreDelay > 0.f)
+	for (FMountedShard& Shard : MountedShards)
 	{
-		TLD_PRESENTATION_DESIGNER(this, TEXT("Timing Control"), 
-			FString::Printf(TEXT("%.1fs delay â†’ smooth transitions"), PreDelay), 
-			TEXT("No jarring cuts â†’ Professional polish"));
-		GetWorld()->GetTimerManager().SetTimer(PreDelayHandle, this, &UTLDCinematicManager::StartSequence, PreDelay, false);
+		if (Shard.Handle.IsValid())
+		{
+			Shard.Handle->CancelHandle();
+		}
 	}
-	else
+	MountedShards.Reset();
+	PendingShardLoads = 0;
+
+	// Workers read the configs directly; let them finish before the game instance lets go of them
+	UE::Tasks::Wait(SnapshotBuildTasks);
+	SnapshotBuildTasks.Reset();
+	SnapshotBuildConfigs.Reset();
+	SnapshotBuildsInFlight = 0;
+	PublishedSnapshotSerial = ++SnapshotBuildSerial;
+	bSnapshotRebuildScheduled = false;
+	// Completions already queued on the game thread must not touch the torn-down manager
+	bDeinitialized = true;
+
+	Super::Deinitialize();
+}
+
+void UTLDCinematicManager::PlaySequence(ULevelSequence* Sequence, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay,
+	ETLDCinematicQueuePolicy Policy, int32 Priority)
+{
+	if (!Sequence || !GetWorld())
 	{
-		StartSequence();
+		TLD_CINEMATIC_ARCHITECTURE(this, TEXT("Cinematic Manager"), 
+			TEXT("Plays cutscenes â†’ Controls game pause â†’ Handles skipping"), 
+			TEXT("System validation â†’ Prevents crashes"));
+		return;
 	}
+
+	FTLDCinematicRequest Request;
+	Request.DirectSequence = Sequence;
+	Request.bPauseGame = bPauseGame;
+	Request.bSkippable = bSkippable;
+	Request.PreDelay = PreDelay;
+	Request.PostDelay = PostDelay;
+	Request.Policy = Policy;
+	Request.Priority = Priority;
+	RequestCinematic(MoveTemp(Request));
 }
 
-bool UTLDCinematicManager::PlayCinematicByName(const FString& CinematicName, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay)
+bool UTLDCinematicManager::PlayCinematicByName(const FString& CinematicName, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay,
+	ETLDCinematicQueuePolicy Policy, int32 Priority)
 {
-	TLD_PRESENTATION_ARCHITECTURE(this, TEXT("Name-Based System"), 
+	TLD_CINEMATIC_ARCHITECTURE(this, TEXT("Name-Based System"), 
 		FString::Printf(TEXT("'%s' â†’ Config lookup â†’ Asset resolution"), *CinematicName), 
 		TEXT("No asset references â†’ Just type name"));
 
 	if (CinematicName.IsEmpty())
 	{
-		TLD_PRESENTATION_INTEGRATION(this, TEXT("Input Validation"), 
+		TLD_CINEMATIC_INTEGRATION(this, TEXT("Input Validation"), 
 			TEXT("Empty name â†’ Clear error"), 
 			TEXT("Safe failure â†’ Easy debugging"));
 		return false;
 	}
 
-	const UTLDProjectSettings* ProjectSettings = UTLDProjectSettings::Get();
-	if (!ProjectSettings || ProjectSettings->CinematicConfigAsset.IsNull())
+	FTLDCinematicRequest Request;
+	Request.CinematicName = FName(*CinematicName);
+	Request.bPauseGame = bPauseGame;
+	Request.bSkippable = bSkippable;
+	Request.PreDelay = PreDelay;
+	Request.PostDelay = PostDelay;
+	Request.Policy = Policy;
+	Request.Priority = Priority;
+	return RequestCinematic(MoveTemp(Request));
+}
+
+bool UTLDCinematicManager::PlayCinematicByNameAsync(FName CinematicName, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay,
+	FTLDOnCinematicRequestComplete OnComplete)
+{
+	return PlayCinematicById(CinematicName, INDEX_NONE, bPauseGame, bSkippable, PreDelay, PostDelay, MoveTemp(OnComplete));
+}
+
+bool UTLDCinematicManager::PlayCinematicById(FName CinematicId, int32 IndexHint, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay,
+	FTLDOnCinematicRequestComplete OnComplete)
+{
+	FTLDCinematicRequest Request;
+	Request.CinematicName = CinematicId;
+	Request.IndexHint = IndexHint;
+	Request.bPauseGame = bPauseGame;
+	Request.bSkippable = bSkippable;
+	Request.PreDelay = PreDelay;
+	Request.PostDelay = PostDelay;
+	Request.OnComplete.Add(MoveTemp(OnComplete));
+	return RequestCinematic(MoveTemp(Request));
+}
+
+bool UTLDCinematicManager::PlayCinematicPlaylist(const TArray<FName>& CinematicNames, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay,
+	ETLDCinematicQueuePolicy Policy, int32 Priority)
+{
+	TLD_CINEMATIC_ARCHITECTURE(this, TEXT("Playlist"), 
+		FString::Printf(TEXT("%d clips â†’ One pause â†’ Gapless handoff"), CinematicNames.Num()), 
+		TEXT("Next player pre-bound â†’ No teardown between clips"));
+
+	FTLDCinematicRequest Request;
+	Request.PlaylistNames = CinematicNames;
+	Request.PlaylistNames.Remove(NAME_None);
+	if (Request.PlaylistNames.Num() == 0)
 	{
-		TLD_PRESENTATION_INTEGRATION(this, TEXT("Config Missing"), 
-			TEXT("Project Settings â†’ TLD â†’ Set Cinematic Config"), 
-			TEXT("Centralized setup â†’ Team workflow"));
+		TLD_CINEMATIC_INTEGRATION(this, TEXT("Input Validation"), 
+			TEXT("Empty playlist â†’ Clear error"), 
+			TEXT("Safe failure â†’ Easy debugging"));
 		return false;
 	}
 
-	UTLDCinematicConfig* Config = ProjectSettings->CinematicConfigAsset.LoadSynchronous();
-	if (!Config)
+	Request.CinematicName = Request.PlaylistNames[0];
+	Request.bPauseGame = bPauseGame;
+	Request.bSkippable = bSkippable;
+	Request.PreDelay = PreDelay;
+	Request.PostDelay = PostDelay;
+	Request.Policy = Policy;
+	Request.Priority = Priority;
+	return RequestCinematic(MoveTemp(Request));
+}
+
+bool UTLDCinematicManager::RequestCinematic(FTLDCinematicRequest&& Request)
+{
+	if ((Request.CinematicName.IsNone() && !Request.DirectSequence) || !GetWorld())
 	{
-		TLD_PRESENTATION_TECHNICAL(this, TEXT("Asset Loading"), 
-			TEXT("Config load failed â†’ Check asset"), 
-			TEXT("Asset validation â†’ Error reporting"));
+		BroadcastRequestComplete(Request, false);
 		return false;
 	}
 
-	ULevelSequence* Sequence = Config->GetSequenceByName(CinematicName);
-	if (!Sequence)
+	if (!Request.DirectSequence)
 	{
-		TLD_PRESENTATION_DESIGNER(this, TEXT("Sequence Not Found"), 
-			FString::Printf(TEXT("'%s' missing from config"), *CinematicName), 
-			TEXT("Add to config â†’ Update list"));
-		return false;
+		// The settings are only consulted while the snapshot is still loading
+		const UTLDProjectSettings* ProjectSettings = ConfigSnapshot ? nullptr : UTLDProjectSettings::Get();
+		if (!ConfigSnapshot && (!ProjectSettings || ProjectSettings->CinematicConfigAsset.IsNull()) && PendingShardLoads == 0)
+		{
+			TLD_CINEMATIC_INTEGRATION(this, TEXT("Config Missing"), 
+				TEXT("Project Settings â†’ TLD â†’ Set Cinematic Config"), 
+				TEXT("Centralized setup â†’ Team workflow"));
+			BroadcastRequestComplete(Request, false);
+			return false;
+		}
+
+		// Once the config and its shards are resident, unknown names fail fast instead of going async
+		if (IsConfigReady() && !ConfigSnapshot->FindSequence(Request.CinematicName, Request.IndexHint))
+		{
+			TLD_CINEMATIC_DESIGNER(this, TEXT("Sequence Not Found"), 
+				FString::Printf(TEXT("'%s' missing from config"), *Request.CinematicName.ToString()), 
+				TEXT("Add to config â†’ Update list"));
+			BroadcastRequestComplete(Request, false);
+			return false;
+		}
+	}
+
+	Request.PreDelay = FMath::Max(0.f, Request.PreDelay);
+	Request.PostDelay = FMath::Max(0.f, Request.PostDelay);
+	Request.Serial = ++RequestSerialCounter;
+	Request.RequestTime = FPlatformTime::Seconds();
+
+	if (Request.Layer == ETLDCinematicLayer::Ambient)
+	{
+		return StartAmbientRequest(MoveTemp(Request));
+	}
+
+	if (IsPlaying())
+	{
+		switch (Request.Policy)
+		{
+		case ETLDCinematicQueuePolicy::DropIfBusy:
+			TLD_CINEMATIC_DESIGNER(this, TEXT("Single Playback"), 
+				TEXT("One cinematic at a time"), 
+				TEXT("Prevents conflicts â†’ Clean experience"));
+			BroadcastRequestComplete(Request, false);
+			return false;
+
+		case ETLDCinematicQueuePolicy::Enqueue:
+			return EnqueueRequest(MoveTemp(Request));
+
+		case ETLDCinematicQueuePolicy::Interrupt:
+			// Made from a completion callback while the current request tears down: nothing left to interrupt
+			if (PlaybackState == ETLDCinematicPlaybackState::Cleanup)
+			{
+				return EnqueueRequest(MoveTemp(Request));
+			}
+			TLD_CINEMATIC_DESIGNER(this, TEXT("Interrupt"), 
+				TEXT("Current cinematic stopped â†’ New one starts"), 
+				TEXT("Story priority â†’ Designer choice"));
+			AbortActiveRequest();
+			break;
+		}
 	}
 
-	TLD_PRESENTATION_INTEGRATION(this, TEXT("System Communication"), 
-		TEXT("Config â†’ Manager â†’ Playback"), 
-		TEXT("String name â†’ Asset â†’ Play"));
-	PlaySequence(Sequence, bPauseGame, bSkippable, PreDelay, PostDelay);
+	BeginRequest(MoveTemp(Request));
 	return true;
 }
 
-void UTLDCinematicManager::StartSequence()
+void UTLDCinematicManager::BeginRequest(FTLDCinematicRequest&& Request)
 {
-	if (!PendingSequence || !GetWorld())
+	ActiveRequest = MoveTemp(Request);
+	PendingSequence = ActiveRequest.DirectSequence;
+	PendingSoftSequence.Reset();
+	bAllowSkip = false;
+	SetPlaybackState(ETLDCinematicPlaybackState::Loading);
+
+	TLD_CINEMATIC_DESIGNER(this, TEXT("Cutscene Request"), 
+		FString::Printf(TEXT("%s â†’ Pause:%s Skip:%s"), 
+			PendingSequence ? *PendingSequence->GetName() : *ActiveRequest.CinematicName.ToString(), 
+			ActiveRequest.bPauseGame ? TEXT("Y") : TEXT("N"), ActiveRequest.bSkippable ? TEXT("Y") : TEXT("N")), 
+		TEXT("Designer controls â†’ Blueprint callable"));
+
+	PublishReplicatedRequest(ActiveRequest);
+
+	// PreDelay and streaming run side by side; playback starts when the later of the two finishes
+	if (ActiveRequest.PreDelay > 0.f)
+	{
+		TLD_CINEMATIC_DESIGNER(this, TEXT("Timing Control"), 
+			FString::Printf(TEXT("%.1fs delay â†’ overlaps async load"), ActiveRequest.PreDelay), 
+			TEXT("Load hidden behind delay â†’ No hitch"));
+		StartPlaybackTimer(ActiveRequest.PreDelay);
+	}
+
+	if (PendingSequence)
+	{
+		OnPendingLoadDone();
+	}
+	else
+	{
+		RequestConfig(FSimpleDelegate::CreateUObject(this, &UTLDCinematicManager::OnPendingConfigReady, ActiveRequest.Serial));
+	}
+}
+
+bool UTLDCinematicManager::EnqueueRequest(FTLDCinematicRequest&& Request)
+{
+	// Coalesce: a name that is already waiting keeps its place and takes the higher priority
+	if (!Request.CinematicName.IsNone())
+	{
+		FTLDCinematicRequest* Existing = RequestQueue.FindByPredicate([&Request](const FTLDCinematicRequest& Queued)
+		{
+			return Queued.CinematicName == Request.CinematicName && Queued.PlaylistNames == Request.PlaylistNames;
+		});
+		if (Existing)
+		{
+			Existing->Priority = FMath::Max(Existing->Priority, Request.Priority);
+			Existing->OnComplete.Append(MoveTemp(Request.OnComplete));
+			RequestQueue.StableSort([](const FTLDCinematicRequest& A, const FTLDCinematicRequest& B) { return A.Priority > B.Priority; });
+			PrefetchQueueHead();
+			UpdateLiveStats();
+			return true;
+		}
+	}
+
+	// Full: a new request only gets in by displacing a lower-priority one
+	const int32 MaxQueued = UTLDCinematicSettings::Get()->MaxQueuedRequests;
+	if (RequestQueue.Num() >= MaxQueued)
+	{
+		if (MaxQueued <= 0 || RequestQueue.Last().Priority >= Request.Priority)
+		{
+			TLD_CINEMATIC_DESIGNER(this, TEXT("Queue Full"), 
+				FString::Printf(TEXT("%d waiting â†’ Request dropped"), RequestQueue.Num()), 
+				TEXT("Bounded queue â†’ Raise priority if it matters"));
+			BroadcastRequestComplete(Request, false);
+			return false;
+		}
+
+		FTLDCinematicRequest Displaced = RequestQueue.Pop(false);
+		BroadcastRequestComplete(Displaced, false);
+	}
+
+	TLD_CINEMATIC_DESIGNER(this, TEXT("Queued"), 
+		FString::Printf(TEXT("'%s' â†’ Priority %d â†’ Plays after current"), *Request.CinematicName.ToString(), Request.Priority), 
+		TEXT("No lost requests â†’ Story beats chain"));
+
+	const int32 InsertAt = RequestQueue.IndexOfByPredicate([&Request](const FTLDCinematicRequest& Queued)
+	{
+		return Queued.Priority < Request.Priority;
+	});
+	RequestQueue.Insert(MoveTemp(Request), InsertAt == INDEX_NONE ? RequestQueue.Num() : InsertAt);
+	PrefetchQueueHead();
+	UpdateLiveStats();
+	return true;
+}
+
+void UTLDCinematicManager::DispatchNextRequest()
+{
+	if (IsPlaying() || RequestQueue.Num() == 0 || !GetWorld())
 	{
-		TLD_PRESENTATION_INTEGRATION(this, TEXT("State Check"), 
-			TEXT("Missing data â†’ Safe cleanup"), 
-			TEXT("Defensive code â†’ System stability"));
-		bIsPlaying = false;
 		return;
 	}
 
-	TLD_PRESENTATION_TECHNICAL(this, TEXT("UE5 Player Creation"), 
-		FString::Printf(TEXT("LevelSequencePlayer â†’ %s"), *PendingSequence->GetName()), 
-		TEXT("Engine integration â†’ Input control"));
+	FTLDCinematicRequest Next = MoveTemp(RequestQueue[0]);
+	RequestQueue.RemoveAt(0);
+	PrefetchQueueHead();
+	UpdateLiveStats();
+	BeginRequest(MoveTemp(Next));
+}
 
-	FMovieSceneSequencePlaybackSettings Settings;
-	Settings.bDisableLookAtInput = true;
-	Settings.bDisableMovementInput = true;
-	Settings.bHideHud = false;
+void UTLDCinematicManager::PrefetchQueueHead()
+{
+	// The head of the queue streams while the current cinematic plays, so it starts without a load gap
+	const FName HeadName = RequestQueue.Num() > 0 ? RequestQueue[0].CinematicName : NAME_None;
+	if (HeadName == QueuedPrefetchName)
+	{
+		return;
+	}
 
-	ActivePlayer = nullptr;
-	ActiveActor = nullptr;
+	if (!QueuedPrefetchName.IsNone())
+	{
+		ReleasePrefetch(QueuedPrefetchName, this);
+	}
+	QueuedPrefetchName = HeadName;
+	if (!QueuedPrefetchName.IsNone())
+	{
+		PrefetchCinematic(QueuedPrefetchName, this);
+	}
+}
 
-	ActivePlayer = ULevelSequencePlayer::CreateLevelSequencePlayer(GetWorld(), PendingSequence, Settings, ActiveActor);
+void UTLDCinematicManager::BroadcastRequestComplete(FTLDCinematicRequest& Request, bool bStarted)
+{
+	TArray<FTLDOnCinematicRequestComplete> Callbacks = MoveTemp(Request.OnComplete);
+	Request.OnComplete.Reset();
+	for (FTLDOnCinematicRequestComplete& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound(bStarted);
+	}
 
-	if (!ActivePlayer || !ActiveActor)
+	const FName ResolvedName = Request.DirectSequence ? Request.DirectSequence->GetFName() : Request.CinematicName;
+	OnCinematicResolved.Broadcast(ResolvedName, bStarted);
+	UpdateLiveStats();
+}
+
+TArray<FSoftObjectPath> UTLDCinematicManager::MakeLoadPaths(const TSoftObjectPtr<ULevelSequence>& Sequence, FName CinematicName, bool bStartSequence) const
+{
+	TArray<FSoftObjectPath> Paths;
+	Paths.Add(Sequence.ToSoftObjectPath());
+
+	// One batched request: the tracks' meshes, anims and sounds arrive with the sequence instead of on first evaluation
+	if (bStartSequence && ConfigSnapshot)
+	{
+		Paths.Append(ConfigSnapshot->FindPreloadAssets(CinematicName));
+	}
+	return Paths;
+}
+
+int64 UTLDCinematicManager::GetCacheSizeHint(FName CinematicName) const
+{
+	// Sectioned entries' manifests describe their first section, not the whole sequence the cache would hold
+	if (!ConfigSnapshot || ConfigSnapshot->FindSections(CinematicName).Num() > 0)
+	{
+		return 0;
+	}
+	return ConfigSnapshot->GetPreloadBytes(CinematicName);
+}
+
+void UTLDCinematicManager::AddToSequenceCache(FName CinematicName, ULevelSequence* Sequence)
+{
+	if (!Sequence)
 	{
-		TLD_PRESENTATION_INTEGRATION(this, TEXT("Player Failed"), 
-			TEXT("Engine creation failed â†’ Cleanup"), 
-			TEXT("Graceful failure â†’ Error handling"));
-		bIsPlaying = false;
 		return;
 	}
 
-	TLD_PRESENTATION_ARCHITECTURE(this, TEXT("Systems Connected"), 
-		TEXT("Player â†’ Input â†’ Pause â†’ Skip"), 
-		TEXT("All systems talking â†’ Clean state"));
+	// The entry is budgeted by its manifest bytes, so it takes its own hold on the manifest. The assets have just
+	// arrived with the sequence, so this request completes on issue.
+	TSharedPtr<FStreamableHandle> ManifestHandle;
+	const TArrayView<const FSoftObjectPath> Manifest = ConfigSnapshot && ConfigSnapshot->FindSections(CinematicName).Num() == 0
+		? ConfigSnapshot->FindPreloadAssets(CinematicName)
+		: TArrayView<const FSoftObjectPath>();
+	if (Manifest.Num() > 0)
+	{
+		ManifestHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(TArray<FSoftObjectPath>(Manifest.GetData(), Manifest.Num()));
+	}
+	SequenceCache.Add(CinematicName, Sequence, GetCacheSizeHint(CinematicName), MoveTemp(ManifestHandle));
+}
 
-	ActivePlayer->OnFinished.AddDynamic(this, &UTLDCinematicManager::HandleSequenceFinished);
-	ApplyPause(bPendingPause);
-	bAllowSkip = bPendingSkippable;
-	ActivePlayer->Play();
+void UTLDCinematicManager::RecordStartLatency(const FTLDCinematicRequest& Request)
+{
+	const double StartMs = (FPlatformTime::Seconds() - Request.RequestTime) * 1000.0;
+	const FName ResolvedName = Request.DirectSequence ? Request.DirectSequence->GetFName() : Request.CinematicName;
+	SET_FLOAT_STAT(STAT_TLDCinematic_LastStartMs, StartMs);
+	TRACE_BOOKMARK(TEXT("TLDCinematic %s: %.1f ms to play (load %.1f ms)"), *ResolvedName.ToString(), StartMs, Request.LoadMs);
+
+#if TLD_CINEMATIC_LATENCY_TRACKING
+	FStartLatency& Latency = StartLatencies.FindOrAdd(ResolvedName);
+	++Latency.Count;
+	Latency.LastMs = StartMs;
+	Latency.MinMs = FMath::Min(Latency.MinMs, StartMs);
+	Latency.MaxMs = FMath::Max(Latency.MaxMs, StartMs);
+	Latency.TotalMs += StartMs;
+	Latency.TotalLoadMs += Request.LoadMs;
+#endif
 }
 
-void UTLDCinematicManager::HandleSequenceFinished()
+void UTLDCinematicManager::UpdateLiveStats() const
 {
-	TLD_PRESENTATION_TECHNICAL(this, TEXT("Cleanup Sequence"), 
-		FString::Printf(TEXT("Cinematic ended â†’ %.1fs post-delay"), PendingPostDelay), 
-		TEXT("Restore game state â†’ Clean transition"));
+#if STATS
+	SET_DWORD_STAT(STAT_TLDCinematic_CacheHits, SequenceCache.GetHits());
+	SET_DWORD_STAT(STAT_TLDCinematic_CacheMisses, SequenceCache.GetMisses());
+	SET_DWORD_STAT(STAT_TLDCinematic_CacheResident, SequenceCache.Num());
+	SET_MEMORY_STAT(STAT_TLDCinematic_CacheBytes, SequenceCache.GetResidentBytes());
+	SET_DWORD_STAT(STAT_TLDCinematic_PooledActors, ActorPool.Num());
+	SET_DWORD_STAT(STAT_TLDCinematic_QueuedRequests, RequestQueue.Num());
+	SET_DWORD_STAT(STAT_TLDCinematic_AmbientSlots, AmbientSlots.Num());
+	SET_DWORD_STAT(STAT_TLDCinematic_DeferredReleases, DeferredReleases.Num());
+#endif
+}
 
-	if (!GetWorld())
+#if TLD_CINEMATIC_LATENCY_TRACKING
+void UTLDCinematicManager::DumpStartLatencies(bool bReset)
+{
+	// Includes PreDelay and any time spent queued; Load is the stream alone, 0 on cache hits
+	TArray<TPair<FName, FStartLatency>> Sorted = StartLatencies.Array();
+	Sorted.Sort([](const TPair<FName, FStartLatency>& A, const TPair<FName, FStartLatency>& B) { return A.Value.MaxMs > B.Value.MaxMs; });
+
+	UE_LOG(LogTLDCinematicManager, Display, TEXT("Cinematic start latency: %d names"), Sorted.Num());
+	for (const TPair<FName, FStartLatency>& Pair : Sorted)
+	{
+		const FStartLatency& Latency = Pair.Value;
+		UE_LOG(LogTLDCinematicManager, Display, TEXT("  %s: n=%u last=%.1f min=%.1f avg=%.1f max=%.1f load avg=%.1f ms"),
+			*Pair.Key.ToString(), Latency.Count, Latency.LastMs, Latency.MinMs, Latency.TotalMs / Latency.Count,
+			Latency.MaxMs, Latency.TotalLoadMs / Latency.Count);
+	}
+
+	if (bReset)
+	{
+		StartLatencies.Reset();
+	}
+}
+#endif
+
+void UTLDCinematicManager::RequestConfig(FSimpleDelegate&& OnReady)
+{
+	const UTLDProjectSettings* ProjectSettings = UTLDProjectSettings::Get();
+	if (!LoadedConfig && ProjectSettings && ProjectSettings->CinematicConfigAsset.Get())
 	{
-		bIsPlaying = false;
+		PublishConfigSnapshot();
+	}
+
+	if (!IsConfigLoadInFlight() && (LoadedConfig || !ProjectSettings || ProjectSettings->CinematicConfigAsset.IsNull()))
+	{
+		OnReady.ExecuteIfBound();
 		return;
 	}
 
-	bAllowSkip = false;
+	if (OnReady.IsBound())
+	{
+		++EarlyConfigRequests;
+		ConfigWaiters.Add(MoveTemp(OnReady));
+	}
+
+	// Only shards (or the index build) are outstanding; their callbacks flush the waiters
+	if (!ProjectSettings || ProjectSettings->CinematicConfigAsset.IsNull() || LoadedConfig
+		|| (ConfigLoadHandle.IsValid() && ConfigLoadHandle->IsLoadingInProgress()))
+	{
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Async Config"), 
+		TEXT("StreamableManager â†’ Config DataAsset"), 
+		TEXT("No game-thread block â†’ Callback on load"));
+	ConfigLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ProjectSettings->CinematicConfigAsset.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &UTLDCinematicManager::OnConfigLoaded));
+}
 
-	if (PendingPostDelay > 0.f)
+void UTLDCinematicManager::OnConfigLoaded()
+{
+	ConfigLoadHandle.Reset();
+	PublishConfigSnapshot();
+	FlushConfigWaiters();
+}
+
+bool UTLDCinematicManager::IsConfigLoadInFlight() const
+{
+	return PendingShardLoads > 0 || IsSnapshotBuildInFlight() || (ConfigLoadHandle.IsValid() && ConfigLoadHandle->IsLoadingInProgress());
+}
+
+void UTLDCinematicManager::FlushConfigWaiters()
+{
+	if (IsConfigLoadInFlight())
+	{
+		return;
+	}
+
+	if (EarlyConfigRequests > 0)
+	{
+		UE_LOG(LogTLDCinematicManager, Log, TEXT("Cinematic config %s: %d requests waited for the config load"),
+			ConfigSnapshot ? TEXT("ready") : TEXT("FAILED to load"), EarlyConfigRequests);
+		EarlyConfigRequests = 0;
+	}
+
+	TArray<FSimpleDelegate> Waiters = MoveTemp(ConfigWaiters);
+	for (FSimpleDelegate& Waiter : Waiters)
+	{
+		Waiter.ExecuteIfBound();
+	}
+}
+
+void UTLDCinematicManager::PublishConfigSnapshot()
+{
+	// Resolve through the soft pointer: the load callback can run before RequestAsyncLoad returns the handle
+	const UTLDProjectSettings* ProjectSettings = UTLDProjectSettings::Get();
+	LoadedConfig = ProjectSettings ? ProjectSettings->CinematicConfigAsset.Get() : nullptr;
+
+	TArray<const UTLDCinematicConfig*> Configs;
+	Configs.Add(LoadedConfig);
+	int32 TotalEntries = LoadedConfig ? LoadedConfig->Cinematics.Num() : 0;
+	for (const FMountedShard& Shard : MountedShards)
 	{
-		GetWorld()->GetTimerManager().SetTimer(PostDelayHandle, [this]()
+		if (UTLDCinematicConfig* ShardConfig = Cast<UTLDCinematicConfig>(Shard.ShardPath.ResolveObject()))
 		{
-			TLD_PRESENTATION_TECHNICAL(this, TEXT("Post-Delay Complete"), 
-				TEXT("Timer â†’ Unpause â†’ Reset â†’ Ready"), 
-				TEXT("System cleanup â†’ Next cinematic ready"));
-			ApplyPause(false);
-			ActivePlayer = nullptr;
-			ActiveActor = nullptr;
-			bIsPlaying = false;
-		}, PendingPostDelay, false);
+			Configs.Add(ShardConfig);
+			TotalEntries += ShardConfig->Cinematics.Num();
+		}
 	}
-	else
+
+	// Any build still running is superseded by this one
+	const uint32 BuildSerial = ++SnapshotBuildSerial;
+	if (!LoadedConfig && Configs.Num() == 1)
 	{
-		ApplyPause(false);
-		ActivePlayer = nullptr;
-		ActiveActor = nullptr;
-		bIsPlaying = false;
+		ConfigSnapshot.Reset();
+		PublishedSnapshotSerial = BuildSerial;
+		return;
+	}
+
+	if (TotalEntries < TLDAsyncSnapshotMinEntries)
+	{
+		OnConfigSnapshotBuilt(FTLDCinematicConfigSnapshot::Build(Configs), BuildSerial);
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Config Snapshot"), 
+		FString::Printf(TEXT("%d entries from %d configs â†’ Worker build"), TotalEntries, Configs.Num()), 
+		TEXT("Name hashing off the game thread â†’ Boot time flat in cinematic count"));
+
+	for (const UTLDCinematicConfig* Config : Configs)
+	{
+		if (Config)
+		{
+			SnapshotBuildConfigs.AddUnique(const_cast<UTLDCinematicConfig*>(Config));
+		}
 	}
+
+	++SnapshotBuildsInFlight;
+	TWeakObjectPtr<UTLDCinematicManager> WeakThis(this);
+	SnapshotBuildTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Configs = MoveTemp(Configs), BuildSerial]()
+	{
+		TSharedRef<const FTLDCinematicConfigSnapshot> Snapshot = FTLDCinematicConfigSnapshot::Build(Configs);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Snapshot = MoveTemp(Snapshot), BuildSerial]()
+		{
+			UTLDCinematicManager* Manager = WeakThis.Get();
+			if (Manager && !Manager->bDeinitialized)
+			{
+				Manager->OnAsyncSnapshotBuilt(Snapshot, BuildSerial);
+			}
+		});
+	}));
 }
 
-void UTLDCinematicManager::SkipCurrentCinematic()
+void UTLDCinematicManager::OnAsyncSnapshotBuilt(TSharedRef<const FTLDCinematicConfigSnapshot> Snapshot, uint32 BuildSerial)
 {
-	TLD_PRESENTATION_DESIGNER(this, TEXT("Skip Control"), 
-		FString::Printf(TEXT("Skip allowed? %s"), bAllowSkip ? TEXT("Yes") : TEXT("No")), 
-		TEXT("User input â†’ System check â†’ Action"));
+	// The worker has finished reading its configs by the time this runs; once none remain, nothing reads them
+	check(SnapshotBuildsInFlight > 0);
+	if (--SnapshotBuildsInFlight == 0)
+	{
+		SnapshotBuildTasks.Reset();
+		SnapshotBuildConfigs.Reset();
+	}
+
+	OnConfigSnapshotBuilt(MoveTemp(Snapshot), BuildSerial);
+
+	// Inline builds are flushed by PublishConfigSnapshot's caller; here the build was the last thing waited on
+	FlushConfigWaiters();
+}
 
-	if (!bIsPlaying || !bAllowSkip || !ActivePlayer)
+void UTLDCinematicManager::OnConfigSnapshotBuilt(TSharedRef<const FTLDCinematicConfigSnapshot> Snapshot, uint32 BuildSerial)
+{
+	if (BuildSerial != SnapshotBuildSerial)
 	{
-		TLD_PRESENTATION_DESIGNER(this, TEXT("Skip Denied"), 
-			TEXT("Not skippable â†’ Request ignored"), 
-			TEXT("Designer control â†’ Protected sequences"));
 		return;
 	}
 
-	TLD_PRESENTATION_INTEGRATION(this, TEXT("Skip Execute"), 
-		TEXT("Stop player â†’ Trigger cleanup â†’ Restore game"), 
-		TEXT("Immediate response â†’ Clean state"));
-	ActivePlayer->Stop();
-	HandleSequenceFinished();
+	ConfigSnapshot = MoveTemp(Snapshot);
+	PublishedSnapshotSerial = BuildSerial;
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Config Snapshot"), 
+		FString::Printf(TEXT("%d cinematics â†’ Shared read-only"), ConfigSnapshot->Num()), 
+		TEXT("Only mounted shards indexed â†’ Lookup scales with loaded levels"));
+}
+
+void UTLDCinematicManager::MountConfigShardsForLevel(FName LevelPackage)
+{
+	TArray<FSoftObjectPath> Shards;
+	UTLDCinematicConfig::FindShardsForLevel(LevelPackage, Shards);
+
+	for (const FSoftObjectPath& ShardPath : Shards)
+	{
+		const bool bAlreadyMounted = MountedShards.ContainsByPredicate([&ShardPath](const FMountedShard& Shard)
+		{
+			return Shard.ShardPath == ShardPath;
+		});
+		if (bAlreadyMounted)
+		{
+			continue;
+		}
+
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Config Shard"), 
+			FString::Printf(TEXT("Mount %s â†’ %s"), *ShardPath.GetAssetName(), *LevelPackage.ToString()), 
+			TEXT("Per-level config â†’ Loaded with its level"));
+
+		FMountedShard& Shard = MountedShards.AddDefaulted_GetRef();
+		Shard.LevelPackage = LevelPackage;
+		Shard.ShardPath = ShardPath;
+		Shard.bLoading = true;
+		++PendingShardLoads;
+
+		// The callback may run inside RequestAsyncLoad, so the handle is written back by path afterwards
+		TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ShardPath,
+			FStreamableDelegate::CreateUObject(this, &UTLDCinematicManager::OnShardLoaded, ShardPath));
+		if (FMountedShard* Mounted = MountedShards.FindByPredicate([&ShardPath](const FMountedShard& Entry) { return Entry.ShardPath == ShardPath; }))
+		{
+			Mounted->Handle = Handle;
+		}
+	}
+}
+
+void UTLDCinematicManager::UnmountConfigShardsForLevel(FName LevelPackage)
+{
+	const int32 Removed = MountedShards.RemoveAll([this, LevelPackage](FMountedShard& Shard)
+	{
+		if (Shard.LevelPackage != LevelPackage)
+		{
+			return false;
+		}
+
+		if (Shard.bLoading)
+		{
+			--PendingShardLoads;
+			if (Shard.Handle.IsValid())
+			{
+				Shard.Handle->CancelHandle();
+			}
+		}
+		else if (Shard.Handle.IsValid())
+		{
+			Shard.Handle->ReleaseHandle();
+		}
+		return true;
+	});
+
+	if (Removed > 0)
+	{
+		ScheduleConfigSnapshotRebuild();
+	}
+}
+
+void UTLDCinematicManager::OnShardLoaded(FSoftObjectPath ShardPath)
+{
+	FMountedShard* Shard = MountedShards.FindByPredicate([&ShardPath](const FMountedShard& Entry) { return Entry.ShardPath == ShardPath; });
+	if (!Shard || !Shard->bLoading)
+	{
+		return;
+	}
+
+	Shard->bLoading = false;
+	--PendingShardLoads;
+	ScheduleConfigSnapshotRebuild();
+}
+
+void UTLDCinematicManager::ScheduleConfigSnapshotRebuild()
+{
+	if (bSnapshotRebuildScheduled)
+	{
+		return;
+	}
+
+	// The game instance's timers survive travel, so a rebuild scheduled during a world teardown still runs
+	UGameInstance* GameInstance = GetGameInstance();
+	if (!GameInstance)
+	{
+		PublishConfigSnapshot();
+		FlushConfigWaiters();
+		return;
+	}
+
+	bSnapshotRebuildScheduled = true;
+	GameInstance->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UTLDCinematicManager::RunScheduledSnapshotRebuild));
+}
+
+void UTLDCinematicManager::RunScheduledSnapshotRebuild()
+{
+	if (!bSnapshotRebuildScheduled)
+	{
+		return;
+	}
+
+	bSnapshotRebuildScheduled = false;
+	PublishConfigSnapshot();
+	FlushConfigWaiters();
+}
+
+bool UTLDCinematicManager::IsOwnWorld(const UWorld* World) const
+{
+	return World && World->IsGameWorld() && World->GetGameInstance() == GetGameInstance();
+}
+
+void UTLDCinematicManager::OnWorldInitializedActors(const FActorsInitializedParams& Params)
+{
+	// Before BeginPlay, so triggers validating their names see the map's shards
+	if (IsOwnWorld(Params.World))
+	{
+		MountConfigShardsForLevel(FName(*UWorld::RemovePIEPrefix(Params.World->GetOutermost()->GetName())));
+	}
+}
+
+void UTLDCinematicManager::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (!IsOwnWorld(World))
+	{
+		return;
+	}
+
+	// The world's timers go with it, so a request waiting on a delay here would never leave its state
+	AbortActiveRequest();
+
+	// Ambient slots hold spawned actors, post-delay timers and the throttle timer in this world; end them,
+	// then flush so their deferred stops run before the world's actors are torn down
+	StopAllAmbientCinematics();
+	FlushDeferredReleases();
+
+	LastAppliedReplicator.Reset();
+	LastAppliedNetSerial = 0;
+	World->GameStateSetEvent.Remove(GameStateSetHandle);
+	GameStateSetHandle.Reset();
+	DeferredReplicator.Reset();
+
+#if TLD_CINEMATIC_RUNTIME_VALIDATION
+	// The next-tick flush dies with the world's timers; without this, validation would stay off for the session
+	PendingNameValidations.Reset();
+	bNameValidationScheduled = false;
+#endif
+
+	TArray<FName> Levels;
+	for (const FMountedShard& Shard : MountedShards)
+	{
+		Levels.AddUnique(Shard.LevelPackage);
+	}
+	for (const FName Level : Levels)
+	{
+		UnmountConfigShardsForLevel(Level);
+	}
+}
+
+void UTLDCinematicManager::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (Level && IsOwnWorld(World))
+	{
+		MountConfigShardsForLevel(FName(*UWorld::RemovePIEPrefix(Level->GetOutermost()->GetName())));
+	}
+}
+
+void UTLDCinematicManager::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	// A null level means the whole world is going away; OnWorldCleanup handles that
+	if (Level && IsOwnWorld(World))
+	{
+		UnmountConfigShardsForLevel(FName(*UWorld::RemovePIEPrefix(Level->GetOutermost()->GetName())));
+	}
+}
+
+void UTLDCinematicManager::OnPendingConfigReady(uint32 Serial)
+{
+	if (Serial != ActiveRequest.Serial || PlaybackState != ETLDCinematicPlaybackState::Loading)
+	{
+		return;
+	}
+
+	TLD_CINEMATIC_SCOPE(STAT_TLDCinematic_ConfigResolve, "ConfigResolve");
+
+	if (!ConfigSnapshot)
+	{
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Asset Loading"), 
+			TEXT("Config load failed â†’ Check asset"), 
+			TEXT("Asset validation â†’ Error reporting"));
+		CompletePendingRequest(false);
+		return;
+	}
+
+	// A sectioned entry plays as a playlist of its sections, so only the first one has to be resident to start
+	const TSoftObjectPtr<ULevelSequence>* ConfigSequence = ConfigSnapshot->FindSequence(ActiveRequest.CinematicName, ActiveRequest.IndexHint);
+	const TArrayView<const TSoftObjectPtr<ULevelSequence>> Sections = ActiveRequest.PlaylistNames.Num() == 0
+		? ConfigSnapshot->FindSections(ActiveRequest.CinematicName, ActiveRequest.IndexHint)
+		: TArrayView<const TSoftObjectPtr<ULevelSequence>>();
+	if (!ConfigSequence || (ConfigSequence->IsNull() && Sections.Num() == 0))
+	{
+		TLD_CINEMATIC_DESIGNER(this, TEXT("Sequence Not Found"), 
+			FString::Printf(TEXT("'%s' missing from config"), *ActiveRequest.CinematicName.ToString()), 
+			TEXT("Add to config â†’ Update list"));
+		CompletePendingRequest(false);
+		return;
+	}
+
+	if (Sections.Num() > 0)
+	{
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Sectioned Streaming"), 
+			FString::Printf(TEXT("'%s' â†’ %d sections â†’ Next streams behind the playhead"), *ActiveRequest.CinematicName.ToString(), Sections.Num()), 
+			TEXT("Start on first section â†’ Played sections released"));
+		ActiveRequest.PlaylistNames.Init(ActiveRequest.CinematicName, Sections.Num());
+		ActiveRequest.PlaylistSequences = TArray<TSoftObjectPtr<ULevelSequence>>(Sections.GetData(), Sections.Num());
+	}
+
+	if (ActiveRequest.PlaylistSequences.Num() > 0)
+	{
+		PendingSoftSequence = ActiveRequest.PlaylistSequences[ActiveRequest.PlaylistIndex];
+	}
+	else
+	{
+		PendingSoftSequence = *ConfigSequence;
+
+		// A cache hit holds its manifest with it, so it can start without a request of its own
+		if (ULevelSequence* Cached = SequenceCache.Find(ActiveRequest.CinematicName))
+		{
+			PendingSequence = Cached;
+			OnPendingLoadDone();
+			return;
+		}
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Async Streaming"), 
+		FString::Printf(TEXT("'%s' â†’ StreamableManager"), *ActiveRequest.CinematicName.ToString()), 
+		TEXT("No LoadSynchronous â†’ No overlap hitch"));
+	ActiveRequest.LoadStartTime = FPlatformTime::Seconds();
+	const bool bStartSequence = ActiveRequest.PlaylistSequences.Num() > 0 || ConfigSnapshot->FindSections(ActiveRequest.CinematicName).Num() == 0;
+	RequestSequenceLoad(PendingLoadHandle, MakeLoadPaths(PendingSoftSequence, ActiveRequest.CinematicName, bStartSequence),
+		FStreamableDelegate::CreateUObject(this, &UTLDCinematicManager::OnPendingSequenceLoaded, Serial),
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UTLDCinematicManager::OnPendingSequenceLoaded(uint32 Serial)
+{
+	if (Serial != ActiveRequest.Serial || PlaybackState != ETLDCinematicPlaybackState::Loading)
+	{
+		return;
+	}
+
+	PendingSequence = PendingSoftSequence.Get();
+	if (!PendingSequence)
+	{
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Asset Loading"), 
+			FString::Printf(TEXT("'%s' stream failed â†’ Check asset"), *ActiveRequest.CinematicName.ToString()), 
+			TEXT("Asset validation â†’ Error reporting"));
+		CompletePendingRequest(false);
+		return;
+	}
+
+	ActiveRequest.LoadMs = static_cast<float>((FPlatformTime::Seconds() - ActiveRequest.LoadStartTime) * 1000.0);
+	SET_FLOAT_STAT(STAT_TLDCinematic_LastLoadMs, ActiveRequest.LoadMs);
+
+	if (ActiveRequest.PlaylistSequences.Num() == 0)
+	{
+		AddToSequenceCache(ActiveRequest.CinematicName, PendingSequence);
+	}
+	OnPendingLoadDone();
+}
+
+void UTLDCinematicManager::OnPendingLoadDone()
+{
+	// Loaded inside the PreDelay: OnPlaybackTimer starts it when the countdown ends
+	if (IsPlaybackTimerPending())
+	{
+		SetPlaybackState(ETLDCinematicPlaybackState::PreDelay);
+		return;
+	}
+
+	StartSequence();
+	CompletePendingRequest(PlaybackState == ETLDCinematicPlaybackState::Playing);
+}
+
+void UTLDCinematicManager::CompletePendingRequest(bool bStarted)
+{
+	// A started clip keeps its handle, so manifest assets nothing else references stay resident while it plays
+	if (bStarted)
+	{
+		BroadcastRequestComplete(ActiveRequest, true);
+		return;
+	}
+
+	SetPlaybackState(ETLDCinematicPlaybackState::Cleanup);
+	BroadcastRequestComplete(ActiveRequest, false);
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PlaybackTimerHandle);
+	}
+	PendingLoadHandle.Reset();
+	PendingSequence = nullptr;
+	SetPlaybackState(ETLDCinematicPlaybackState::Idle);
+	DispatchNextRequest();
+}
+
+void UTLDCinematicManager::SetPlaybackState(ETLDCinematicPlaybackState NewState)
+{
+	if (PlaybackState == NewState)
+	{
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Playback State"), 
+		FString::Printf(TEXT("%s â†’ %s"), *UEnum::GetDisplayValueAsText(PlaybackState).ToString(), *UEnum::GetDisplayValueAsText(NewState).ToString()), 
+		TEXT("One state â†’ One timer â†’ No per-play closures"));
+	PlaybackState = NewState;
+}
+
+bool UTLDCinematicManager::IsPendingRequestActive() const
+{
+	return PlaybackState == ETLDCinematicPlaybackState::Loading || PlaybackState == ETLDCinematicPlaybackState::PreDelay;
+}
+
+void UTLDCinematicManager::StartPlaybackTimer(float Delay)
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().SetTimer(PlaybackTimerHandle, this, &UTLDCinematicManager::OnPlaybackTimer, Delay, false);
+	}
+}
+
+bool UTLDCinematicManager::IsPlaybackTimerPending() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetTimerManager().IsTimerPending(PlaybackTimerHandle);
+}
+
+void UTLDCinematicManager::OnPlaybackTimer()
+{
+	switch (PlaybackState)
+	{
+	case ETLDCinematicPlaybackState::PreDelay:
+		StartSequence();
+		CompletePendingRequest(PlaybackState == ETLDCinematicPlaybackState::Playing);
+		break;
+
+	case ETLDCinematicPlaybackState::PostDelay:
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Post-Delay Complete"), 
+			TEXT("Timer â†’ Unpause â†’ Reset â†’ Ready"), 
+			TEXT("System cleanup â†’ Next cinematic ready"));
+		FinishActiveRequest();
+		break;
+
+	default:
+		// Loading outlasted the PreDelay; OnPendingLoadDone sees the countdown has ended and starts playback
+		break;
+	}
+}
+
+void UTLDCinematicManager::ResetActivePlayback()
+{
+	EndReplicatedRequest(false);
+	const bool bWasPending = IsPendingRequestActive();
+	SetPlaybackState(ETLDCinematicPlaybackState::Cleanup);
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PlaybackTimerHandle);
+	}
+
+	if (bWasPending)
+	{
+		BroadcastRequestComplete(ActiveRequest, false);
+	}
+
+	// Pause, input and camera come back now; the actor and its references go over the next frames
+	ApplyPause(false);
+	ReleaseNextPlayer();
+	ReleaseActorDeferred(ActiveActor, true, MoveTemp(PendingLoadHandle));
+	PendingLoadHandle.Reset();
+	ActivePlayer = nullptr;
+	ActiveActor = nullptr;
+	PendingSequence = nullptr;
+	ActiveRequest = FTLDCinematicRequest();
+	bAwaitingHandoff = false;
+	bAllowSkip = false;
+	SetPlaybackState(ETLDCinematicPlaybackState::Idle);
+}
+
+void UTLDCinematicManager::AbortActiveRequest()
+{
+	if (IsPlaying() && PlaybackState != ETLDCinematicPlaybackState::Cleanup)
+	{
+		EndReplicatedRequest(true);
+		ResetActivePlayback();
+	}
+}
+
+void UTLDCinematicManager::FinishActiveRequest()
+{
+	ResetActivePlayback();
+	DispatchNextRequest();
+}
+
+bool UTLDCinematicManager::PlayAmbientCinematic(FName CinematicName, bool bSkippable, float PreDelay, float PostDelay, ETLDCinematicQueuePolicy Policy,
+	const AActor* SourceActor)
+{
+	FTLDCinematicRequest Request;
+	Request.CinematicName = CinematicName;
+	Request.bPauseGame = false;
+	Request.bSkippable = bSkippable;
+	Request.PreDelay = PreDelay;
+	Request.PostDelay = PostDelay;
+	Request.Policy = Policy;
+	Request.Layer = ETLDCinematicLayer::Ambient;
+	Request.SourceActor = SourceActor;
+	return RequestCinematic(MoveTemp(Request));
+}
+
+bool UTLDCinematicManager::StartAmbientRequest(FTLDCinematicRequest&& Request)
+{
+	const int32 MaxAmbient = UTLDCinematicSettings::Get()->MaxAmbientCinematics;
+	if (AmbientSlots.Num() >= MaxAmbient)
+	{
+		if (MaxAmbient <= 0 || Request.Policy != ETLDCinematicQueuePolicy::Interrupt)
+		{
+			TLD_CINEMATIC_DESIGNER(this, TEXT("Ambient Slots Full"), 
+				FString::Printf(TEXT("%d playing â†’ '%s' dropped"), AmbientSlots.Num(), *Request.CinematicName.ToString()), 
+				TEXT("Bounded layer â†’ Raise MaxAmbientCinematics or use Interrupt"));
+			BroadcastRequestComplete(Request, false);
+			return false;
+		}
+		EndAmbientSlot(0);
+	}
+
+	TLD_CINEMATIC_DESIGNER(this, TEXT("Ambient Request"), 
+		FString::Printf(TEXT("'%s' â†’ Slot %d â†’ No pause"), *Request.CinematicName.ToString(), AmbientSlots.Num()), 
+		TEXT("Runs beside story â†’ Not starved by other reveals"));
+
+	const uint32 Serial = Request.Serial;
+	FTLDCinematicSlot& Slot = AmbientSlots.AddDefaulted_GetRef();
+	Slot.Request = MoveTemp(Request);
+	Slot.Request.bPauseGame = false;
+	Slot.Sequence = Slot.Request.DirectSequence;
+	Slot.bLoadDone = Slot.Sequence != nullptr;
+	Slot.bPreDelayDone = Slot.Request.PreDelay <= 0.f;
+
+	if (!Slot.bPreDelayDone)
+	{
+		GetWorld()->GetTimerManager().SetTimer(Slot.PreDelayHandle,
+			FTimerDelegate::CreateUObject(this, &UTLDCinematicManager::OnAmbientPreDelayElapsed, Serial), Slot.Request.PreDelay, false);
+	}
+
+	if (Slot.bLoadDone)
+	{
+		TryStartAmbientSlot(AmbientSlots.Num() - 1);
+	}
+	else
+	{
+		RequestConfig(FSimpleDelegate::CreateUObject(this, &UTLDCinematicManager::OnAmbientConfigReady, Serial));
+	}
+	return true;
+}
+
+int32 UTLDCinematicManager::FindAmbientSlot(uint32 Serial) const
+{
+	return AmbientSlots.IndexOfByPredicate([Serial](const FTLDCinematicSlot& Slot) { return Slot.Request.Serial == Serial; });
+}
+
+void UTLDCinematicManager::OnAmbientConfigReady(uint32 Serial)
+{
+	const int32 SlotIndex = FindAmbientSlot(Serial);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	TLD_CINEMATIC_SCOPE(STAT_TLDCinematic_ConfigResolve, "ConfigResolve");
+
+	FTLDCinematicSlot& Slot = AmbientSlots[SlotIndex];
+	const FName CinematicName = Slot.Request.CinematicName;
+	const TSoftObjectPtr<ULevelSequence>* ConfigSequence = ConfigSnapshot ? ConfigSnapshot->FindSequence(CinematicName, Slot.Request.IndexHint) : nullptr;
+	if (!ConfigSequence || ConfigSequence->IsNull())
+	{
+		TLD_CINEMATIC_DESIGNER(this, TEXT("Sequence Not Found"), 
+			FString::Printf(TEXT("'%s' missing from config"), *CinematicName.ToString()), 
+			TEXT("Add to config â†’ Update list"));
+		EndAmbientSlot(SlotIndex);
+		return;
+	}
+
+	Slot.SoftSequence = *ConfigSequence;
+	Slot.Sequence = SequenceCache.Find(CinematicName);
+	if (Slot.Sequence)
+	{
+		Slot.bLoadDone = true;
+		TryStartAmbientSlot(SlotIndex);
+		return;
+	}
+
+	// Normal priority: ambient reveals should not compete with a story cinematic's stream
+	Slot.Request.LoadStartTime = FPlatformTime::Seconds();
+	RequestSequenceLoad(Slot.LoadHandle, MakeLoadPaths(Slot.SoftSequence, CinematicName, ConfigSnapshot->FindSections(CinematicName).Num() == 0),
+		FStreamableDelegate::CreateUObject(this, &UTLDCinematicManager::OnAmbientSequenceLoaded, Serial));
+}
+
+void UTLDCinematicManager::OnAmbientSequenceLoaded(uint32 Serial)
+{
+	const int32 SlotIndex = FindAmbientSlot(Serial);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// The slot keeps its handle until it ends, for the same reason as the story clip
+	FTLDCinematicSlot& Slot = AmbientSlots[SlotIndex];
+	Slot.Sequence = Slot.SoftSequence.Get();
+	if (!Slot.Sequence)
+	{
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Asset Loading"), 
+			FString::Printf(TEXT("'%s' stream failed â†’ Check asset"), *Slot.Request.CinematicName.ToString()), 
+			TEXT("Asset validation â†’ Error reporting"));
+		EndAmbientSlot(SlotIndex);
+		return;
+	}
+
+	Slot.Request.LoadMs = static_cast<float>((FPlatformTime::Seconds() - Slot.Request.LoadStartTime) * 1000.0);
+	SET_FLOAT_STAT(STAT_TLDCinematic_LastLoadMs, Slot.Request.LoadMs);
+
+	AddToSequenceCache(Slot.Request.CinematicName, Slot.Sequence);
+	Slot.bLoadDone = true;
+	TryStartAmbientSlot(SlotIndex);
+}
+
+void UTLDCinematicManager::OnAmbientPreDelayElapsed(uint32 Serial)
+{
+	const int32 SlotIndex = FindAmbientSlot(Serial);
+	if (SlotIndex != INDEX_NONE)
+	{
+		AmbientSlots[SlotIndex].bPreDelayDone = true;
+		TryStartAmbientSlot(SlotIndex);
+	}
+}
+
+void UTLDCinematicManager::TryStartAmbientSlot(int32 SlotIndex)
+{
+	FTLDCinematicSlot& Slot = AmbientSlots[SlotIndex];
+	if (Slot.bStarted || !Slot.bLoadDone || !Slot.bPreDelayDone)
+	{
+		return;
+	}
+
+	const FMovieSceneSequencePlaybackSettings Settings = MakeCinematicPlaybackSettings(ETLDCinematicLayer::Ambient);
+	ULevelSequencePlayer* Player = nullptr;
+	{
+		TLD_CINEMATIC_SCOPE(STAT_TLDCinematic_PlayerSpawn, "PlayerSpawn");
+		Slot.Actor = AcquirePooledActor(Slot.Sequence, Settings);
+		if (Slot.Actor)
+		{
+			Player = Slot.Actor->GetSequencePlayer();
+		}
+		else
+		{
+			Player = ULevelSequencePlayer::CreateLevelSequencePlayer(GetWorld(), Slot.Sequence, Settings, Slot.Actor);
+		}
+	}
+
+	if (!Player || !Slot.Actor)
+	{
+		TLD_CINEMATIC_INTEGRATION(this, TEXT("Player Failed"), 
+			TEXT("Engine creation failed â†’ Cleanup"), 
+			TEXT("Graceful failure â†’ Error handling"));
+		EndAmbientSlot(SlotIndex);
+		return;
+	}
+
+	// OnFinished carries no context, so each slot binds the native event with its serial
+	Slot.bStarted = true;
+	Player->OnNativeFinished.AddUObject(this, &UTLDCinematicManager::HandleAmbientFinished, Slot.Request.Serial);
+	BroadcastRequestComplete(Slot.Request, true);
+	{
+		TLD_CINEMATIC_SCOPE(STAT_TLDCinematic_Play, "Play");
+		Player->Play();
+	}
+	RecordStartLatency(Slot.Request);
+
+	const UTLDCinematicSettings* CinematicSettings = UTLDCinematicSettings::Get();
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (CinematicSettings->bThrottleAmbientCinematics && !TimerManager.IsTimerActive(AmbientThrottleHandle))
+	{
+		TimerManager.SetTimer(AmbientThrottleHandle, this, &UTLDCinematicManager::UpdateAmbientThrottle,
+			CinematicSettings->AmbientThrottleInterval, true);
+	}
+}
+
+void UTLDCinematicManager::HandleAmbientFinished(uint32 Serial)
+{
+	const int32 SlotIndex = FindAmbientSlot(Serial);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FTLDCinematicSlot& Slot = AmbientSlots[SlotIndex];
+	if (Slot.Request.PostDelay > 0.f && GetWorld())
+	{
+		GetWorld()->GetTimerManager().SetTimer(Slot.PostDelayHandle,
+			FTimerDelegate::CreateUObject(this, &UTLDCinematicManager::OnAmbientPostDelayElapsed, Serial), Slot.Request.PostDelay, false);
+	}
+	else
+	{
+		EndAmbientSlot(SlotIndex);
+	}
+}
+
+void UTLDCinematicManager::OnAmbientPostDelayElapsed(uint32 Serial)
+{
+	const int32 SlotIndex = FindAmbientSlot(Serial);
+	if (SlotIndex != INDEX_NONE)
+	{
+		EndAmbientSlot(SlotIndex);
+	}
+}
+
+void UTLDCinematicManager::EndAmbientSlot(int32 SlotIndex)
+{
+	FTLDCinematicSlot Slot = MoveTemp(AmbientSlots[SlotIndex]);
+	AmbientSlots.RemoveAt(SlotIndex);
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(Slot.PreDelayHandle);
+		World->GetTimerManager().ClearTimer(Slot.PostDelayHandle);
+	}
+
+	if (!Slot.bStarted)
+	{
+		BroadcastRequestComplete(Slot.Request, false);
+	}
+
+	// Ambient players hold no camera or input, so even their stop (and spawnable teardown) is deferred
+	ReleaseActorDeferred(Slot.Actor, true, MoveTemp(Slot.LoadHandle), false);
+
+	if (AmbientSlots.Num() == 0 && GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(AmbientThrottleHandle);
+	}
+}
+
+void UTLDCinematicManager::UpdateAmbientThrottle()
+{
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? UGameplayStatics::GetPlayerController(World, 0) : nullptr;
+	const APlayerCameraManager* Camera = PC ? PC->PlayerCameraManager : nullptr;
+	if (!Camera)
+	{
+		return;
+	}
+
+	const UTLDCinematicSettings* Settings = UTLDCinematicSettings::Get();
+	const FVector ViewLocation = Camera->GetCameraLocation();
+	const FVector ViewForward = Camera->GetCameraRotation().Vector();
+	// Widened cone so sequences at the screen edge are not paused while still visible
+	const float CosViewCone = FMath::Cos(FMath::DegreesToRadians(FMath::Min(Camera->GetFOVAngle() * 0.5f + 15.f, 89.f)));
+	const double FullRateDistanceSq = FMath::Square(static_cast<double>(Settings->AmbientFullRateDistance));
+	const double PauseDistanceSq = FMath::Square(static_cast<double>(FMath::Max(Settings->AmbientPauseDistance, Settings->AmbientFullRateDistance)));
+	const double Now = World->GetTimeSeconds();
+
+	for (FTLDCinematicSlot& Slot : AmbientSlots)
+	{
+		ULevelSequencePlayer* Player = Slot.bStarted && Slot.Actor ? Slot.Actor->GetSequencePlayer() : nullptr;
+		if (!Player)
+		{
+			continue;
+		}
+
+		// The sequence actor spawns at the origin, so without a source there is no meaningful position to throttle on
+		ETLDCinematicEvalBucket Bucket = ETLDCinematicEvalBucket::Full;
+		if (const AActor* Source = Slot.Request.SourceActor.Get())
+		{
+			const FVector ToSource = Source->GetActorLocation() - ViewLocation;
+			const double DistanceSq = ToSource.SizeSquared();
+			const bool bInView = DistanceSq <= KINDA_SMALL_NUMBER || FVector::DotProduct(ToSource.GetUnsafeNormal(), ViewForward) >= CosViewCone;
+
+			if (DistanceSq > PauseDistanceSq || (!bInView && Settings->bPauseOffscreenAmbient))
+			{
+				Bucket = ETLDCinematicEvalBucket::Paused;
+			}
+			else if (DistanceSq > FullRateDistanceSq)
+			{
+				Bucket = ETLDCinematicEvalBucket::Stepped;
+			}
+		}
+		SetAmbientBucket(Slot, *Player, Bucket, Now);
+
+		if (Slot.Bucket == ETLDCinematicEvalBucket::Stepped)
+		{
+			const float Elapsed = static_cast<float>(Now - Slot.LastStepTime) * Player->GetPlayRate();
+			const float Target = Player->GetCurrentTime().AsSeconds() + Elapsed;
+			Slot.LastStepTime = Now;
+
+			if (Target >= Player->GetEndTime().AsSeconds())
+			{
+				// Let the player run out the last stretch itself so finish and loop handling stay Sequencer's
+				SetAmbientBucket(Slot, *Player, ETLDCinematicEvalBucket::Full, Now);
+			}
+			else
+			{
+				Player->SetPlaybackPosition(FMovieSceneSequencePlaybackParams(Target, EUpdatePositionMethod::Play));
+			}
+		}
+	}
+}
+
+void UTLDCinematicManager::SetAmbientBucket(FTLDCinematicSlot& Slot, ULevelSequencePlayer& Player, ETLDCinematicEvalBucket Bucket, double Now)
+{
+	if (Slot.Bucket == Bucket)
+	{
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Ambient Throttle"), 
+		FString::Printf(TEXT("'%s' â†’ %s"), *Slot.Request.CinematicName.ToString(), 
+			Bucket == ETLDCinematicEvalBucket::Full ? TEXT("Full rate") : Bucket == ETLDCinematicEvalBucket::Stepped ? TEXT("Stepped") : TEXT("Paused")), 
+		TEXT("Far or offscreen â†’ Less Sequencer evaluation"));
+
+	Slot.Bucket = Bucket;
+	Slot.LastStepTime = Now;
+	if (Bucket == ETLDCinematicEvalBucket::Full)
+	{
+		Player.Play();
+	}
+	else if (Player.IsPlaying())
+	{
+		Player.Pause();
+	}
+}
+
+bool UTLDCinematicManager::SkipAmbientCinematic(FName CinematicName)
+{
+	const int32 SlotIndex = AmbientSlots.IndexOfByPredicate([CinematicName](const FTLDCinematicSlot& Slot)
+	{
+		return Slot.Request.CinematicName == CinematicName && Slot.Request.bSkippable;
+	});
+	if (SlotIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	ULevelSequencePlayer* Player = AmbientSlots[SlotIndex].Actor ? AmbientSlots[SlotIndex].Actor->GetSequencePlayer() : nullptr;
+	if (Player && AmbientSlots[SlotIndex].bStarted && UTLDCinematicSettings::Get()->SkipMode == ETLDCinematicSkipMode::JumpToEnd)
+	{
+		Player->OnNativeFinished.RemoveAll(this);
+		Player->GoToEndAndStop();
+	}
+
+	EndAmbientSlot(SlotIndex);
+	return true;
+}
+
+void UTLDCinematicManager::StopAllAmbientCinematics()
+{
+	while (AmbientSlots.Num() > 0)
+	{
+		EndAmbientSlot(AmbientSlots.Num() - 1);
+	}
+}
+
+void UTLDCinematicManager::PrefetchCinematic(FName CinematicName, const UObject* Requester)
+{
+	if (CinematicName.IsNone())
+	{
+		return;
+	}
+
+	// One entry per call: a requester may hold several references (the manager's queue head and a pin)
+	FPrefetchRecord& Record = Prefetches.FindOrAdd(CinematicName);
+	Record.Requesters.Add(Requester);
+	if (Record.Requesters.Num() > 1)
+	{
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Proximity Prefetch"), 
+		FString::Printf(TEXT("'%s' â†’ Stream ahead of trigger"), *CinematicName.ToString()), 
+		TEXT("Player nearby â†’ Zero-hitch start"));
+	RequestConfig(FSimpleDelegate::CreateUObject(this, &UTLDCinematicManager::OnPrefetchConfigReady, CinematicName));
+}
+
+void UTLDCinematicManager::OnPrefetchConfigReady(FName CinematicName)
+{
+	FPrefetchRecord* Record = Prefetches.Find(CinematicName);
+	if (!Record || Record->Handle.IsValid() || !ConfigSnapshot)
+	{
+		return;
+	}
+
+	// Sectioned entries only need their first section ahead of the trigger; the handle keeps it resident
+	const TArrayView<const TSoftObjectPtr<ULevelSequence>> Sections = ConfigSnapshot->FindSections(CinematicName);
+	const TSoftObjectPtr<ULevelSequence>* ConfigSequence = Sections.Num() > 0 ? &Sections[0] : ConfigSnapshot->FindSequence(CinematicName);
+	if (!ConfigSequence || ConfigSequence->IsNull())
+	{
+		Prefetches.Remove(CinematicName);
+		return;
+	}
+
+	if (Sections.Num() == 0 && SequenceCache.Find(CinematicName))
+	{
+		return;
+	}
+
+	Record->Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MakeLoadPaths(*ConfigSequence, CinematicName, true),
+		FStreamableDelegate::CreateUObject(this, &UTLDCinematicManager::OnPrefetchLoaded, CinematicName));
+}
+
+void UTLDCinematicManager::OnPrefetchLoaded(FName CinematicName)
+{
+	const TSoftObjectPtr<ULevelSequence>* ConfigSequence = ConfigSnapshot ? ConfigSnapshot->FindSequence(CinematicName) : nullptr;
+	if (ConfigSequence && ConfigSnapshot->FindSections(CinematicName).Num() == 0)
+	{
+		AddToSequenceCache(CinematicName, ConfigSequence->Get());
+	}
+}
+
+ETLDCinematicEvictResult UTLDCinematicManager::EvictResidentCinematic(FName CinematicName)
+{
+	// A prefetched, pinned or playing cinematic keeps its strong reference elsewhere, so evicting it would not make it cold
+	const bool bInAmbientSlot = AmbientSlots.ContainsByPredicate([CinematicName](const FTLDCinematicSlot& Slot)
+	{
+		return Slot.Request.CinematicName == CinematicName;
+	});
+	if (bInAmbientSlot || Prefetches.Contains(CinematicName) || SequenceCache.IsPinned(CinematicName)
+		|| (IsPlaying() && ActiveRequest.CinematicName == CinematicName))
+	{
+		return ETLDCinematicEvictResult::Held;
+	}
+
+	// Pooled players still reference the last sequence they played; those actors go so the sequence can be collected
+	TArray<const UMovieSceneSequence*, TInlineAllocator<8>> Loaded;
+	if (ConfigSnapshot)
+	{
+		if (const TSoftObjectPtr<ULevelSequence>* ConfigSequence = ConfigSnapshot->FindSequence(CinematicName))
+		{
+			Loaded.Add(ConfigSequence->Get());
+		}
+		for (const TSoftObjectPtr<ULevelSequence>& Section : ConfigSnapshot->FindSections(CinematicName))
+		{
+			Loaded.Add(Section.Get());
+		}
+		Loaded.Remove(nullptr);
+	}
+	const int32 PooledBefore = ActorPool.Num();
+	ActorPool.RemoveAll([&Loaded](ALevelSequenceActor* Pooled)
+	{
+		const ULevelSequencePlayer* Player = IsValid(Pooled) ? Pooled->GetSequencePlayer() : nullptr;
+		if (!Player || !Loaded.Contains(Player->GetSequence()))
+		{
+			return false;
+		}
+		Pooled->Destroy();
+		return true;
+	});
+
+	const bool bRemoved = SequenceCache.Remove(CinematicName);
+	UpdateLiveStats();
+	return bRemoved || ActorPool.Num() != PooledBefore ? ETLDCinematicEvictResult::Evicted : ETLDCinematicEvictResult::NotResident;
+}
+
+void UTLDCinematicManager::PinCinematic(FName CinematicName)
+{
+	if (CinematicName.IsNone())
+	{
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Cache Pin"), 
+		FString::Printf(TEXT("'%s' â†’ Resident until unpinned"), *CinematicName.ToString()), 
+		TEXT("Known upcoming beat â†’ No repeat I/O"));
+	SequenceCache.Pin(CinematicName);
+	PrefetchCinematic(CinematicName, this);
+}
+
+void UTLDCinematicManager::UnpinCinematic(FName CinematicName)
+{
+	SequenceCache.Unpin(CinematicName);
+	ReleasePrefetch(CinematicName, this);
+}
+
+void UTLDCinematicManager::ReleasePrefetch(FName CinematicName, const UObject* Requester)
+{
+	FPrefetchRecord* Record = Prefetches.Find(CinematicName);
+	if (!Record)
+	{
+		return;
+	}
+
+	Record->Requesters.RemoveSingle(Requester);
+	Record->Requesters.RemoveAll([](const TWeakObjectPtr<const UObject>& Existing) { return !Existing.IsValid(); });
+
+	if (Record->Requesters.Num() == 0)
+	{
+		if (Record->Handle.IsValid())
+		{
+			Record->Handle->ReleaseHandle();
+		}
+		Prefetches.Remove(CinematicName);
+	}
+}
+
+bool UTLDCinematicManager::HasTriggerFired(const FGuid& TriggerId) const
+{
+	return FiredTriggerIds.Contains(TriggerId);
+}
+
+void UTLDCinematicManager::MarkTriggerFired(const FGuid& TriggerId)
+{
+	if (TriggerId.IsValid())
+	{
+		FiredTriggerIds.Add(TriggerId);
+	}
+}
+
+void UTLDCinematicManager::WriteTriggerSaveData(FTLDCinematicTriggerSaveData& OutSaveData) const
+{
+	OutSaveData.FiredTriggerIds = FiredTriggerIds.Array();
+}
+
+void UTLDCinematicManager::ReadTriggerSaveData(const FTLDCinematicTriggerSaveData& SaveData)
+{
+	ResetTriggerState();
+	FiredTriggerIds.Reserve(SaveData.FiredTriggerIds.Num());
+	for (const FGuid& TriggerId : SaveData.FiredTriggerIds)
+	{
+		MarkTriggerFired(TriggerId);
+	}
+}
+
+void UTLDCinematicManager::ResetTriggerState()
+{
+	FiredTriggerIds.Reset();
+}
+
+#if TLD_CINEMATIC_RUNTIME_VALIDATION
+void UTLDCinematicManager::QueueNameValidation(const AActor* Trigger, FName CinematicName)
+{
+	PendingNameValidations.Add({ Trigger, CinematicName });
+
+	UWorld* World = GetWorld();
+	if (!bNameValidationScheduled && World)
+	{
+		// Everything that begins play this frame (level load, a streamed cell) lands in one batch
+		bNameValidationScheduled = true;
+		World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UTLDCinematicManager::FlushNameValidation));
+	}
+}
+
+void UTLDCinematicManager::FlushNameValidation()
+{
+	RequestConfig(FSimpleDelegate::CreateUObject(this, &UTLDCinematicManager::RunNameValidation));
+}
+
+void UTLDCinematicManager::RunNameValidation()
+{
+	bNameValidationScheduled = false;
+	TArray<FPendingNameValidation> Batch = MoveTemp(PendingNameValidations);
+	if (Batch.Num() == 0)
+	{
+		return;
+	}
+
+	const FString WorldName = GetWorld() ? GetWorld()->GetMapName() : TEXT("<no world>");
+	if (!ConfigSnapshot)
+	{
+		UE_LOG(LogTLDCinematicManager, Error, TEXT("Cinematic validation [%s]: %d triggers, no CinematicConfigAsset loaded"),
+			*WorldName, Batch.Num());
+		return;
+	}
+
+	// Index lookups only: no sequence is loaded to validate a name
+	TArray<FString> Failures;
+	for (const FPendingNameValidation& Pending : Batch)
+	{
+		if (!ConfigSnapshot->HasCinematic(Pending.CinematicName))
+		{
+			const AActor* Trigger = Pending.Trigger.Get();
+			Failures.Add(FString::Printf(TEXT("'%s'@%s"),
+				Pending.CinematicName.IsNone() ? TEXT("<empty>") : *Pending.CinematicName.ToString(),
+				Trigger ? *Trigger->GetName() : TEXT("<gone>")));
+		}
+	}
+
+	if (Failures.Num() > 0)
+	{
+		UE_LOG(LogTLDCinematicManager, Error, TEXT("Cinematic validation [%s]: %d/%d trigger names not in config: %s"),
+			*WorldName, Failures.Num(), Batch.Num(), *FString::Join(Failures, TEXT(", ")));
+	}
+	else
+	{
+		UE_LOG(LogTLDCinematicManager, Verbose, TEXT("Cinematic validation [%s]: %d trigger names OK"), *WorldName, Batch.Num());
+	}
+}
+#endif
+
+void UTLDCinematicManager::StartSequence()
+{
+	if (!PendingSequence || !GetWorld())
+	{
+		TLD_CINEMATIC_INTEGRATION(this, TEXT("State Check"), 
+			TEXT("Missing data â†’ Safe cleanup"), 
+			TEXT("Defensive code â†’ System stability"));
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("UE5 Player Creation"), 
+		FString::Printf(TEXT("LevelSequencePlayer â†’ %s"), *PendingSequence->GetName()), 
+		TEXT("Engine integration â†’ Input control"));
+
+	const FMovieSceneSequencePlaybackSettings Settings = MakeCinematicPlaybackSettings();
+
+	ActivePlayer = nullptr;
+	{
+		TLD_CINEMATIC_SCOPE(STAT_TLDCinematic_PlayerSpawn, "PlayerSpawn");
+		ActiveActor = AcquirePooledActor(PendingSequence, Settings);
+
+		if (ActiveActor)
+		{
+			ActivePlayer = ActiveActor->GetSequencePlayer();
+		}
+		else
+		{
+			ActivePlayer = ULevelSequencePlayer::CreateLevelSequencePlayer(GetWorld(), PendingSequence, Settings, ActiveActor);
+		}
+	}
+
+	if (!ActivePlayer || !ActiveActor)
+	{
+		TLD_CINEMATIC_INTEGRATION(this, TEXT("Player Failed"), 
+			TEXT("Engine creation failed â†’ Cleanup"), 
+			TEXT("Graceful failure â†’ Error handling"));
+		return;
+	}
+
+	TLD_CINEMATIC_ARCHITECTURE(this, TEXT("Systems Connected"), 
+		TEXT("Player â†’ Input â†’ Pause â†’ Skip"), 
+		TEXT("All systems talking â†’ Clean state"));
+
+	ActivePlayer->OnFinished.AddUniqueDynamic(this, &UTLDCinematicManager::HandleSequenceFinished);
+	SetPlaybackState(ETLDCinematicPlaybackState::Playing);
+	ApplyPause(ActiveRequest.bPauseGame);
+	bAllowSkip = ActiveRequest.bSkippable;
+	{
+		TLD_CINEMATIC_SCOPE(STAT_TLDCinematic_Play, "Play");
+		ActivePlayer->Play();
+	}
+	AlignToNetStartTime();
+	RecordStartLatency(ActiveRequest);
+
+	PrepareNextPlaylistEntry();
+}
+
+bool UTLDCinematicManager::HasNextPlaylistEntry() const
+{
+	return ActiveRequest.PlaylistNames.IsValidIndex(ActiveRequest.PlaylistIndex + 1);
+}
+
+void UTLDCinematicManager::PrepareNextPlaylistEntry()
+{
+	ReleaseNextPlayer();
+	if (HasNextPlaylistEntry())
+	{
+		RequestConfig(FSimpleDelegate::CreateUObject(this, &UTLDCinematicManager::OnNextConfigReady, ActiveRequest.Serial));
+	}
+}
+
+void UTLDCinematicManager::OnNextConfigReady(uint32 Serial)
+{
+	if (Serial != ActiveRequest.Serial || !IsPlaying() || !HasNextPlaylistEntry())
+	{
+		return;
+	}
+
+	const FName NextName = ActiveRequest.PlaylistNames[ActiveRequest.PlaylistIndex + 1];
+	const bool bSectioned = ActiveRequest.PlaylistSequences.Num() > 0;
+	const TSoftObjectPtr<ULevelSequence>* ConfigSequence = bSectioned
+		? &ActiveRequest.PlaylistSequences[ActiveRequest.PlaylistIndex + 1]
+		: (ConfigSnapshot ? ConfigSnapshot->FindSequence(NextName) : nullptr);
+	if (!ConfigSequence || ConfigSequence->IsNull())
+	{
+		TLD_CINEMATIC_DESIGNER(this, TEXT("Sequence Not Found"), 
+			FString::Printf(TEXT("Playlist clip '%s' missing from config â†’ Skipped"), *NextName.ToString()), 
+			TEXT("Add to config â†’ Update list"));
+		SkipNextPlaylistEntry();
+		return;
+	}
+
+	NextSoftSequence = *ConfigSequence;
+	if (ULevelSequence* Cached = bSectioned ? nullptr : SequenceCache.Find(NextName))
+	{
+		BindNextPlayer(Cached);
+		TryPlaylistHandoff();
+		return;
+	}
+
+	RequestSequenceLoad(NextLoadHandle,
+		MakeLoadPaths(NextSoftSequence, NextName, !bSectioned && ConfigSnapshot && ConfigSnapshot->FindSections(NextName).Num() == 0),
+		FStreamableDelegate::CreateUObject(this, &UTLDCinematicManager::OnNextSequenceLoaded, Serial),
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UTLDCinematicManager::OnNextSequenceLoaded(uint32 Serial)
+{
+	if (Serial != ActiveRequest.Serial || !IsPlaying() || !HasNextPlaylistEntry())
+	{
+		return;
+	}
+
+	if (ULevelSequence* Sequence = NextSoftSequence.Get())
+	{
+		BindNextPlayer(Sequence);
+		TryPlaylistHandoff();
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Asset Loading"), 
+		FString::Printf(TEXT("Playlist clip '%s' stream failed â†’ Skipped"), *ActiveRequest.PlaylistNames[ActiveRequest.PlaylistIndex + 1].ToString()), 
+		TEXT("Asset validation â†’ Error reporting"));
+	SkipNextPlaylistEntry();
+}
+
+void UTLDCinematicManager::SkipNextPlaylistEntry()
+{
+	ActiveRequest.PlaylistNames.RemoveAt(ActiveRequest.PlaylistIndex + 1);
+	if (ActiveRequest.PlaylistSequences.IsValidIndex(ActiveRequest.PlaylistIndex + 1))
+	{
+		ActiveRequest.PlaylistSequences.RemoveAt(ActiveRequest.PlaylistIndex + 1);
+	}
+	PrepareNextPlaylistEntry();
+	TryPlaylistHandoff();
+}
+
+void UTLDCinematicManager::BindNextPlayer(ULevelSequence* Sequence)
+{
+	if (ActiveRequest.PlaylistSequences.Num() == 0)
+	{
+		AddToSequenceCache(ActiveRequest.PlaylistNames[ActiveRequest.PlaylistIndex + 1], Sequence);
+	}
+
+	// Binding initializes the player and its evaluation template; it is not evaluated until it plays,
+	// so the current clip keeps its camera cut
+	const FMovieSceneSequencePlaybackSettings Settings = MakeCinematicPlaybackSettings();
+	NextActor = AcquirePooledActor(Sequence, Settings);
+	if (!NextActor)
+	{
+		ULevelSequencePlayer::CreateLevelSequencePlayer(GetWorld(), Sequence, Settings, NextActor);
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Playlist Preload"), 
+		FString::Printf(TEXT("%s â†’ Bound, waiting at start"), *Sequence->GetName()), 
+		TEXT("Next player ready â†’ Gapless handoff"));
+}
+
+void UTLDCinematicManager::TryPlaylistHandoff()
+{
+	if (!bAwaitingHandoff)
+	{
+		return;
+	}
+
+	if (!HasNextPlaylistEntry())
+	{
+		// Remaining clips failed to resolve: end the playlist normally
+		bAwaitingHandoff = false;
+		HandleSequenceFinished();
+		return;
+	}
+
+	ULevelSequencePlayer* NextPlayer = NextActor ? NextActor->GetSequencePlayer() : nullptr;
+	if (!NextPlayer)
+	{
+		return;
+	}
+
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Playlist Handoff"), 
+		FString::Printf(TEXT("Clip %d/%d â†’ %s"), ActiveRequest.PlaylistIndex + 2, ActiveRequest.PlaylistNames.Num(), *NextActor->GetName()), 
+		TEXT("Pause and input lock kept â†’ No gap"));
+
+	// Both happen inside one frame, so no gameplay frame renders between the clips
+	// A played section is not coming back, so its actor goes with it and the section can be collected
+	bAwaitingHandoff = false;
+	ReleaseActorDeferred(ActiveActor, ActiveRequest.PlaylistSequences.Num() == 0, MoveTemp(PendingLoadHandle));
+	PendingLoadHandle = MoveTemp(NextLoadHandle);
+	ActiveActor = NextActor;
+	ActivePlayer = NextPlayer;
+	NextActor = nullptr;
+	NextSoftSequence.Reset();
+
+	++ActiveRequest.PlaylistIndex;
+	ActiveRequest.CinematicName = ActiveRequest.PlaylistNames[ActiveRequest.PlaylistIndex];
+	ActivePlayer->OnFinished.AddUniqueDynamic(this, &UTLDCinematicManager::HandleSequenceFinished);
+	ActivePlayer->Play();
+
+	PrepareNextPlaylistEntry();
+}
+
+void UTLDCinematicManager::ReleaseNextPlayer()
+{
+	NextSoftSequence.Reset();
+	if (NextActor)
+	{
+		ReleaseActorDeferred(NextActor, true, MoveTemp(NextLoadHandle));
+		NextActor = nullptr;
+	}
+	NextLoadHandle.Reset();
+}
+
+void UTLDCinematicManager::HandleSequenceFinished()
+{
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Cleanup Sequence"), 
+		FString::Printf(TEXT("Cinematic ended â†’ %.1fs post-delay"), ActiveRequest.PostDelay), 
+		TEXT("Restore game state â†’ Clean transition"));
+
+	if (!GetWorld())
+	{
+		SetPlaybackState(ETLDCinematicPlaybackState::Idle);
+		return;
+	}
+
+	// Mid-playlist: hand off to the pre-bound player; pause and skip state carry over
+	if (HasNextPlaylistEntry())
+	{
+		bAwaitingHandoff = true;
+		TryPlaylistHandoff();
+		return;
+	}
+
+	bAllowSkip = false;
+
+	if (ActiveRequest.PostDelay > 0.f)
+	{
+		// The player has already stopped, so its teardown (and a GC) can run while PostDelay holds gameplay back.
+		// Flag first: with no cleanup budget the release below drains the queue on the spot.
+		// A pooled player keeps its last sequence, so the actor is destroyed when the GC is meant to reclaim it.
+		const bool bCollectGarbage = UTLDCinematicSettings::Get()->bCollectGarbageDuringPostDelay;
+		bCollectGarbageWhenDrained |= bCollectGarbage;
+		ReleaseActorDeferred(ActiveActor, !bCollectGarbage, MoveTemp(PendingLoadHandle));
+		PendingLoadHandle.Reset();
+		ActiveActor = nullptr;
+		ActivePlayer = nullptr;
+
+		SetPlaybackState(ETLDCinematicPlaybackState::PostDelay);
+		StartPlaybackTimer(ActiveRequest.PostDelay);
+	}
+	else
+	{
+		FinishActiveRequest();
+	}
+}
+
+void UTLDCinematicManager::SkipCurrentCinematic()
+{
+	TLD_CINEMATIC_DESIGNER(this, TEXT("Skip Control"), 
+		FString::Printf(TEXT("Skip allowed? %s"), bAllowSkip ? TEXT("Yes") : TEXT("No")), 
+		TEXT("User input â†’ System check â†’ Action"));
+
+	if (PlaybackState != ETLDCinematicPlaybackState::Playing || !bAllowSkip || !ActivePlayer)
+	{
+		TLD_CINEMATIC_DESIGNER(this, TEXT("Skip Denied"), 
+			TEXT("Not skippable â†’ Request ignored"), 
+			TEXT("Designer control â†’ Protected sequences"));
+		return;
+	}
+
+	// Replicated: this is one player's vote; the server skips for everyone once enough are in
+	if (ActiveRequest.NetSerial != 0 && (IsNetClient() || IsNetServer()))
+	{
+		APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+		TLD_CINEMATIC_DESIGNER(this, TEXT("Skip Vote"), 
+			FString::Printf(TEXT("Serial %d â†’ %s"), ActiveRequest.NetSerial, IsNetServer() ? TEXT("Counted") : TEXT("Sent to server")), 
+			TEXT("Co-op â†’ Nobody skipped alone"));
+		if (IsNetServer())
+		{
+			RegisterSkipVote(PC, ActiveRequest.NetSerial);
+		}
+		else if (UTLDCinematicNetComponent* NetComponent = PC ? PC->FindComponentByClass<UTLDCinematicNetComponent>() : nullptr)
+		{
+			NetComponent->ServerVoteSkip(ActiveRequest.NetSerial);
+		}
+		return;
+	}
+
+	SkipActiveRequest();
+}
+
+void UTLDCinematicManager::SkipActiveRequest()
+{
+	TLD_CINEMATIC_INTEGRATION(this, TEXT("Skip Execute"), 
+		TEXT("Stop player â†’ Trigger cleanup â†’ Restore game"), 
+		TEXT("Immediate response â†’ Clean state"));
+	// Skipping a playlist skips all of it
+	if (ActiveRequest.PlaylistNames.Num() > 0)
+	{
+		ActiveRequest.PlaylistNames.SetNum(ActiveRequest.PlaylistIndex + 1);
+		if (ActiveRequest.PlaylistSequences.Num() > 0)
+		{
+			ActiveRequest.PlaylistSequences.SetNum(ActiveRequest.PlaylistIndex + 1);
+		}
+		ReleaseNextPlayer();
+		bAwaitingHandoff = false;
+	}
+
+	if (UTLDCinematicSettings::Get()->SkipMode == ETLDCinematicSkipMode::JumpToEnd)
+	{
+		// One evaluation at the last frame, then the finish runs now: pause, input and the next request all resolve this frame
+		ActivePlayer->OnFinished.RemoveDynamic(this, &UTLDCinematicManager::HandleSequenceFinished);
+		ActivePlayer->GoToEndAndStop();
+		FinishActiveRequest();
+		return;
+	}
+
+	ActivePlayer->Stop();
+	HandleSequenceFinished();
+}
+
+bool UTLDCinematicManager::IsNetServer() const
+{
+	const UWorld* World = GetWorld();
+	const ENetMode NetMode = World ? World->GetNetMode() : NM_Standalone;
+	return NetMode == NM_ListenServer || NetMode == NM_DedicatedServer;
+}
+
+bool UTLDCinematicManager::IsNetClient() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() == NM_Client;
+}
+
+double UTLDCinematicManager::GetServerWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0;
+	}
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+void UTLDCinematicManager::PublishReplicatedRequest(FTLDCinematicRequest& Request)
+{
+	// Named single entries only: clients resolve the name themselves, so direct sequences cannot be sent
+	const UTLDCinematicSettings* Settings = UTLDCinematicSettings::Get();
+	if (!Settings->bReplicateStoryCinematics || !IsNetServer() || Request.DirectSequence || Request.PlaylistNames.Num() > 0
+		|| Request.CinematicName.IsNone())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!IsValid(Replicator) || Replicator->GetWorld() != World)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Replicator = World->SpawnActor<ATLDCinematicReplicator>(SpawnParams);
+		if (!Replicator)
+		{
+			return;
+		}
+	}
+
+	// Seamless travel keeps controllers without a fresh PostLogin, so make sure every voter can reach the server
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (APlayerController* PC = It->Get())
+		{
+			UTLDCinematicNetComponent::FindOrAdd(*PC);
+		}
+	}
+
+	// Pausing the session would stop every player's game and freeze the server clock late joiners align to
+	Request.bPauseGame = false;
+	Request.PreDelay += Settings->NetStartLeadTime;
+	Request.NetStartServerTime = GetServerWorldTime() + Request.PreDelay;
+	Request.NetSerial = Replicator->PublishCinematic(Request.CinematicName, Request.IndexHint, Request.NetStartServerTime, Request.bSkippable);
+	SkipVoters.Reset();
+	Replicator->SetSkipVotes(0, FMath::Max(1, FMath::CeilToInt(Settings->SkipVoteFraction * World->GetNumPlayerControllers())));
+
+	TLD_CINEMATIC_ARCHITECTURE(this, TEXT("Replicated Cinematic"), 
+		FString::Printf(TEXT("'%s' â†’ Serial %d â†’ Starts at server time %.2f"), *Request.CinematicName.ToString(), Request.NetSerial, Request.NetStartServerTime), 
+		TEXT("Name + start time only â†’ Clients load locally"));
+}
+
+void UTLDCinematicManager::EndReplicatedRequest(bool bStopClients)
+{
+	if (ActiveRequest.NetSerial == 0 || !IsNetServer() || !IsValid(Replicator))
+	{
+		return;
+	}
+
+	if (bStopClients)
+	{
+		Replicator->StopCinematic(ActiveRequest.NetSerial);
+	}
+	Replicator->ClearCinematic(ActiveRequest.NetSerial);
+	SkipVoters.Reset();
+}
+
+void UTLDCinematicManager::AlignToNetStartTime()
+{
+	if (ActiveRequest.NetStartServerTime <= 0.0 || !ActivePlayer || !GetWorld()->GetGameState())
+	{
+		return;
+	}
+
+	// Late starters (slow stream, late join) jump to where the server's playhead is instead of syncing every frame
+	const FFrameRate FrameRate = ActivePlayer->GetFrameRate();
+	const double Late = GetServerWorldTime() - ActiveRequest.NetStartServerTime;
+	if (Late < FrameRate.AsInterval())
+	{
+		return;
+	}
+
+	const double Offset = FMath::Min(Late, ActivePlayer->GetDuration().AsSeconds());
+	TLD_CINEMATIC_TECHNICAL(this, TEXT("Net Alignment"), 
+		FString::Printf(TEXT("%.0fms behind server â†’ Jump ahead"), Late * 1000.0), 
+		TEXT("One jump â†’ No per-frame sync"));
+	ActivePlayer->SetPlaybackPosition(FMovieSceneSequencePlaybackParams(
+		ActivePlayer->GetStartTime().Time + FrameRate.AsFrameTime(Offset), EUpdatePositionMethod::Jump));
+}
+
+void UTLDCinematicManager::ApplyReplicatedCinematic(const ATLDCinematicReplicator& Source)
+{
+	const FTLDReplicatedCinematic& Cinematic = Source.GetCinematic();
+	if (!IsNetClient() || Cinematic.Serial == 0)
+	{
+		return;
+	}
+
+	if (LastAppliedReplicator.Get() != &Source)
+	{
+		LastAppliedReplicator = &Source;
+		LastAppliedNetSerial = 0;
+	}
+
+	// Without the GameState the local clock would stand in for the server's; wait for it to replicate
+	UWorld* World = GetWorld();
+	if (!World->GetGameState())
+	{
+		DeferredReplicator = &Source;
+		if (!GameStateSetHandle.IsValid())
+		{
+			GameStateSetHandle = World->GameStateSetEvent.AddUObject(this, &UTLDCinematicManager::OnGameStateSet);
+		}
+		return;
+	}
+
+	if (Cinematic.Serial != LastAppliedNetSerial && !Cinematic.CinematicId.IsNone() && !Cinematic.bStopped)
+	{
+		LastAppliedNetSerial = Cinematic.Serial;
+
+		FTLDCinematicRequest Request;
+		Request.CinematicName = Cinematic.CinematicId;
+		Request.IndexHint = Cinematic.IndexHint;
+		Request.bPauseGame = false;
+		Request.bSkippable = Cinematic.bSkippable;
+		Request.PreDelay = static_cast<float>(FMath::Max(0.0, Cinematic.StartServerTime - GetServerWorldTime()));
+		Request.Policy = ETLDCinematicQueuePolicy::Interrupt;
+		Request.NetSerial = Cinematic.Serial;
+		Request.NetStartServerTime = Cinematic.StartServerTime;
+		RequestCinematic(MoveTemp(Request));
+		return;
+	}
+
+	// The server's vote passed or it abandoned the cinematic; bSkippable was checked there
+	if (Cinematic.bStopped && IsPlaying() && ActiveRequest.NetSerial == Cinematic.Serial)
+	{
+		if (PlaybackState == ETLDCinematicPlaybackState::Playing && ActivePlayer)
+		{
+			SkipActiveRequest();
+		}
+		else if (IsPendingRequestActive())
+		{
+			FinishActiveRequest();
+		}
+	}
+}
+
+void UTLDCinematicManager::RegisterSkipVote(APlayerController* Voter, uint8 Serial)
+{
+	if (!Voter || !IsNetServer() || !IsValid(Replicator) || Serial == 0 || Serial != ActiveRequest.NetSerial
+		|| PlaybackState != ETLDCinematicPlaybackState::Playing || !bAllowSkip)
+	{
+		return;
+	}
+
+	SkipVoters.RemoveAll([](const TWeakObjectPtr<APlayerController>& Existing) { return !Existing.IsValid(); });
+	SkipVoters.AddUnique(Voter);
+
+	const int32 Required = FMath::Max(1, FMath::CeilToInt(UTLDCinematicSettings::Get()->SkipVoteFraction * GetWorld()->GetNumPlayerControllers()));
+	Replicator->SetSkipVotes(SkipVoters.Num(), Required);
+	if (SkipVoters.Num() >= Required)
+	{
+		Replicator->StopCinematic(Serial);
+		SkipActiveRequest();
+	}
+}
+
+void UTLDCinematicManager::OnGameStateSet(AGameStateBase* GameState)
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GameStateSetEvent.Remove(GameStateSetHandle);
+	}
+	GameStateSetHandle.Reset();
+
+	const ATLDCinematicReplicator* Source = DeferredReplicator.Get();
+	DeferredReplicator.Reset();
+	if (Source && GameState)
+	{
+		ApplyReplicatedCinematic(*Source);
+	}
+}
+
+void UTLDCinematicManager::OnGameModePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer)
+{
+	if (NewPlayer && GameMode && IsOwnWorld(GameMode->GetWorld()) && UTLDCinematicSettings::Get()->bReplicateStoryCinematics)
+	{
+		UTLDCinematicNetComponent::FindOrAdd(*NewPlayer);
+	}
+}
+
+ALevelSequenceActor* UTLDCinematicManager::AcquirePooledActor(ULevelSequence* Sequence, const FMovieSceneSequencePlaybackSettings& Settings)
+{
+	UWorld* World = GetWorld();
+	while (ActorPool.Num() > 0)
+	{
+		ALevelSequenceActor* Actor = ActorPool.Pop(false);
+
+		// Actors from a previous world were destroyed with it
+		if (!IsValid(Actor) || Actor->GetWorld() != World || !Actor->GetSequencePlayer())
+		{
+			continue;
+		}
+
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Actor Pool"), 
+			FString::Printf(TEXT("Reuse %s â†’ %s"), *Actor->GetName(), *Sequence->GetName()), 
+			TEXT("No spawn â†’ No GC churn"));
+
+		// SetSequence re-initializes the player from the actor's playback settings
+		Actor->PlaybackSettings = Settings;
+		Actor->SetSequence(Sequence);
+		return Actor;
+	}
+
+	// Back-to-back cinematics take the actor still waiting for its deferred release
+	for (int32 Index = 0; Index < DeferredReleases.Num(); ++Index)
+	{
+		ALevelSequenceActor* Actor = DeferredReleases[Index].Actor;
+		if (!DeferredReleases[Index].bAllowPooling || !IsValid(Actor) || Actor->GetWorld() != World || !Actor->GetSequencePlayer())
+		{
+			continue;
+		}
+		DeferredReleases.RemoveAt(Index);
+
+		if (Actor->GetSequencePlayer()->IsPlaying())
+		{
+			Actor->GetSequencePlayer()->Stop();
+		}
+
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Actor Pool"), 
+			FString::Printf(TEXT("Reclaim %s â†’ %s"), *Actor->GetName(), *Sequence->GetName()), 
+			TEXT("Deferred release skipped â†’ No spawn"));
+
+		Actor->PlaybackSettings = Settings;
+		Actor->SetSequence(Sequence);
+		return Actor;
+	}
+	return nullptr;
+}
+
+void UTLDCinematicManager::ReturnActorToPool(ALevelSequenceActor* Actor, bool bAllowPooling)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	if (ULevelSequencePlayer* Player = Actor->GetSequencePlayer())
+	{
+		Player->OnFinished.RemoveDynamic(this, &UTLDCinematicManager::HandleSequenceFinished);
+		Player->OnNativeFinished.RemoveAll(this);
+		if (Player->IsPlaying())
+		{
+			Player->Stop();
+		}
+	}
+
+	const int32 MaxPooled = UTLDCinematicSettings::Get()->MaxPooledSequenceActors;
+	ActorPool.RemoveAll([](const ALevelSequenceActor* Pooled) { return !IsValid(Pooled); });
+	if (bAllowPooling && Actor->GetWorld() == GetWorld() && ActorPool.Num() < MaxPooled)
+	{
+		ActorPool.Add(Actor);
+	}
+	else
+	{
+		Actor->Destroy();
+	}
+	UpdateLiveStats();
+}
+
+void UTLDCinematicManager::ReleaseActorDeferred(ALevelSequenceActor* Actor, bool bAllowPooling, TSharedPtr<FStreamableHandle>&& LoadHandle, bool bStopNow)
+{
+	if (!IsValid(Actor))
+	{
+		if (LoadHandle.IsValid())
+		{
+			LoadHandle->ReleaseHandle();
+		}
+		return;
+	}
+
+	// No finish callbacks may reach the manager once the actor has been handed off
+	if (ULevelSequencePlayer* Player = Actor->GetSequencePlayer())
+	{
+		Player->OnFinished.RemoveDynamic(this, &UTLDCinematicManager::HandleSequenceFinished);
+		Player->OnNativeFinished.RemoveAll(this);
+		if (bStopNow && Player->IsPlaying())
+		{
+			Player->Stop();
+		}
+	}
+
+	FTLDCinematicDeferredRelease& Release = DeferredReleases.AddDefaulted_GetRef();
+	Release.Actor = Actor;
+	Release.LoadHandle = MoveTemp(LoadHandle);
+	Release.bAllowPooling = bAllowPooling;
+	UpdateLiveStats();
+
+	UWorld* World = GetWorld();
+	if (UTLDCinematicSettings::Get()->CleanupBudgetMs <= 0.f || !World)
+	{
+		// Flushing also clears the GC request, which still applies to an unbudgeted drain
+		const bool bCollectGarbage = bCollectGarbageWhenDrained && World;
+		FlushDeferredReleases();
+		if (bCollectGarbage && GEngine)
+		{
+			GEngine->ForceGarbageCollection(false);
+		}
+		return;
+	}
+
+	if (!World->GetTimerManager().IsTimerPending(DeferredReleaseHandle))
+	{
+		DeferredReleaseHandle = World->GetTimerManager().SetTimerForNextTick(
+			FTimerDelegate::CreateUObject(this, &UTLDCinematicManager::ProcessDeferredReleases));
+	}
+}
+
+void UTLDCinematicManager::ProcessDeferredReleases()
+{
+	TLD_CINEMATIC_SCOPE(STAT_TLDCinematic_DeferredRelease, "DeferredRelease");
+
+	const double Budget = UTLDCinematicSettings::Get()->CleanupBudgetMs / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+	int32 Released = 0;
+
+	// Oldest first, at least one per frame so a single slow Destroy cannot stall the queue
+	while (DeferredReleases.Num() > 0 && (Released == 0 || FPlatformTime::Seconds() - StartTime < Budget))
+	{
+		FTLDCinematicDeferredRelease Release = MoveTemp(DeferredReleases[0]);
+		DeferredReleases.RemoveAt(0);
+
+		ReturnActorToPool(Release.Actor, Release.bAllowPooling);
+		if (Release.LoadHandle.IsValid())
+		{
+			Release.LoadHandle->ReleaseHandle();
+		}
+		++Released;
+	}
+
+	UWorld* World = GetWorld();
+	if (DeferredReleases.Num() > 0 && World)
+	{
+		DeferredReleaseHandle = World->GetTimerManager().SetTimerForNextTick(
+			FTimerDelegate::CreateUObject(this, &UTLDCinematicManager::ProcessDeferredReleases));
+		return;
+	}
+
+	if (bCollectGarbageWhenDrained && GEngine)
+	{
+		TLD_CINEMATIC_TECHNICAL(this, TEXT("Deferred Cleanup"), 
+			TEXT("Releases drained â†’ Incremental GC"), 
+			TEXT("Post-delay window â†’ No hitch on resume"));
+		GEngine->ForceGarbageCollection(false);
+	}
+	bCollectGarbageWhenDrained = false;
+}
+
+void UTLDCinematicManager::FlushDeferredReleases()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DeferredReleaseHandle);
+	}
+
+	TArray<FTLDCinematicDeferredRelease> Releases = MoveTemp(DeferredReleases);
+	for (FTLDCinematicDeferredRelease& Release : Releases)
+	{
+		ReturnActorToPool(Release.Actor, Release.bAllowPooling);
+		if (Release.LoadHandle.IsValid())
+		{
+			Release.LoadHandle->ReleaseHandle();
+		}
+	}
+	bCollectGarbageWhenDrained = false;
 }
 
 void UTLDCinematicManager::ApplyPause(bool bPause)
@@ -206,14 +2421,14 @@ void UTLDCinematicManager::ApplyPause(bool bPause)
 	{
 		if (APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0))
 		{
-			TLD_PRESENTATION_INTEGRATION(this, TEXT("Game Pause"), 
+			TLD_CINEMATIC_INTEGRATION(this, TEXT("Game Pause"), 
 				FString::Printf(TEXT("%s game"), bPause ? TEXT("Pausing") : TEXT("Resuming")), 
 				TEXT("PlayerController â†’ Pause state â†’ Game flow"));
 			PC->SetPause(bPause);
 		}
 		else
 		{
-			TLD_PRESENTATION_INTEGRATION(this, TEXT("Pause Failed"), 
+			TLD_CINEMATIC_INTEGRATION(this, TEXT("Pause Failed"), 
 				TEXT("No PlayerController â†’ Can't pause"), 
 				TEXT("Missing controller â†’ Check setup"));
 		}
@@ -0,0 +1,412 @@
+// TLDCinematicManager.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "LevelSequencePlayer.h"
+#include "Tasks/Task.h"
+#include "UI/TLDCinematicCache.h"
+#include "UI/TLDCinematicDiagnostics.h"
+#include "UI/TLDCinematicTypes.h"
+#include "TLDCinematicManager.generated.h"
+
+class AGameModeBase;
+class AGameStateBase;
+class ALevelSequenceActor;
+class APlayerController;
+class ATLDCinematicReplicator;
+class ULevel;
+class ULevelSequence;
+class UTLDCinematicConfig;
+struct FActorsInitializedParams;
+struct FStreamableHandle;
+struct FTLDCinematicConfigSnapshot;
+struct FTLDReplicatedCinematic;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FTLDOnCinematicResolved, FName, CinematicName, bool, bStarted);
+
+UCLASS()
+class THELASTDROP_API UTLDCinematicManager : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category="Cinematics")
+	void PlaySequence(ULevelSequence* Sequence, bool bPauseGame = true, bool bSkippable = true, float PreDelay = 0.f, float PostDelay = 0.f,
+		ETLDCinematicQueuePolicy Policy = ETLDCinematicQueuePolicy::Enqueue, int32 Priority = 0);
+
+	// Resolves the name asynchronously; returns false only when the request is rejected up front
+	UFUNCTION(BlueprintCallable, Category="Cinematics")
+	bool PlayCinematicByName(const FString& CinematicName, bool bPauseGame = true, bool bSkippable = true, float PreDelay = 0.f, float PostDelay = 0.f,
+		ETLDCinematicQueuePolicy Policy = ETLDCinematicQueuePolicy::Enqueue, int32 Priority = 0);
+
+	// Streams config and sequence in while PreDelay runs, then starts playback once both are done
+	bool PlayCinematicByNameAsync(FName CinematicName, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay,
+		FTLDOnCinematicRequestComplete OnComplete = FTLDOnCinematicRequestComplete());
+
+	// Same as PlayCinematicByNameAsync for IDs baked at save/cook time; IndexHint skips the name hash when still current
+	bool PlayCinematicById(FName CinematicId, int32 IndexHint, bool bPauseGame, bool bSkippable, float PreDelay, float PostDelay,
+		FTLDOnCinematicRequestComplete OnComplete = FTLDOnCinematicRequestComplete());
+
+	// Plays the named cinematics back to back under one pause and input lock; the next clip's player is bound while the current one runs
+	UFUNCTION(BlueprintCallable, Category="Cinematics")
+	bool PlayCinematicPlaylist(const TArray<FName>& CinematicNames, bool bPauseGame = true, bool bSkippable = true, float PreDelay = 0.f, float PostDelay = 0.f,
+		ETLDCinematicQueuePolicy Policy = ETLDCinematicQueuePolicy::Enqueue, int32 Priority = 0);
+
+	// Null until the startup config load completes; requests made before then wait instead of loading synchronously
+	TSharedPtr<const FTLDCinematicConfigSnapshot> GetConfigSnapshot() const { return ConfigSnapshot; }
+
+	// True once the root config and every mounted shard have loaded
+	UFUNCTION(BlueprintPure, Category="Cinematics")
+	bool IsConfigReady() const { return ConfigSnapshot.IsValid() && PendingShardLoads == 0 && !IsSnapshotBuildInFlight(); }
+
+	// Shard configs (UTLDCinematicConfig::ShardLevel) follow their level; called automatically for game worlds
+	void MountConfigShardsForLevel(FName LevelPackage);
+	void UnmountConfigShardsForLevel(FName LevelPackage);
+
+	// Entry point for every play call: starts, queues, interrupts or drops according to Request.Policy
+	bool RequestCinematic(FTLDCinematicRequest&& Request);
+
+#if TLD_CINEMATIC_LATENCY_TRACKING
+	// Request-to-play latency per cinematic name, worst first (tld.Cinematic.DumpLatency)
+	void DumpStartLatencies(bool bReset);
+#endif
+
+	// Drops an unpinned, idle cinematic from the resident cache and the actor pool so its next play streams again (cold-start measurements)
+	ETLDCinematicEvictResult EvictResidentCinematic(FName CinematicName);
+
+	// Starts streaming the mapped sequence and keeps it resident until every requester has released it
+	void PrefetchCinematic(FName CinematicName, const UObject* Requester);
+	void ReleasePrefetch(FName CinematicName, const UObject* Requester);
+
+	// Keeps a sequence the game knows is coming resident regardless of the cache budget
+	UFUNCTION(BlueprintCallable, Category="Cinematics")
+	void PinCinematic(FName CinematicName);
+
+	UFUNCTION(BlueprintCallable, Category="Cinematics")
+	void UnpinCinematic(FName CinematicName);
+
+	// One-shot trigger state keyed by ATLDCinematicTrigger::TriggerId; survives cell unloads and round-trips through save games
+	bool HasTriggerFired(const FGuid& TriggerId) const;
+	void MarkTriggerFired(const FGuid& TriggerId);
+
+	UFUNCTION(BlueprintCallable, Category="Cinematics|Save")
+	void WriteTriggerSaveData(FTLDCinematicTriggerSaveData& OutSaveData) const;
+
+	// Replaces the current state; triggers already in play keep theirs until they are streamed in again
+	UFUNCTION(BlueprintCallable, Category="Cinematics|Save")
+	void ReadTriggerSaveData(const FTLDCinematicTriggerSaveData& SaveData);
+
+	UFUNCTION(BlueprintCallable, Category="Cinematics|Save")
+	void ResetTriggerState();
+
+#if TLD_CINEMATIC_RUNTIME_VALIDATION
+	// Collects trigger names as they BeginPlay; they are checked against the config index in one pass next tick
+	void QueueNameValidation(const AActor* Trigger, FName CinematicName);
+#endif
+
+	// Behaviour follows UTLDCinematicSettings::SkipMode. A replicated cinematic casts this player's skip vote instead.
+	UFUNCTION(BlueprintCallable, Category="Cinematics")
+	void SkipCurrentCinematic();
+
+	UFUNCTION(BlueprintPure, Category="Cinematics")
+	bool IsPlaying() const { return PlaybackState != ETLDCinematicPlaybackState::Idle; }
+
+	UFUNCTION(BlueprintPure, Category="Cinematics")
+	ETLDCinematicPlaybackState GetPlaybackState() const { return PlaybackState; }
+
+	UFUNCTION(BlueprintPure, Category="Cinematics")
+	int32 GetQueuedRequestCount() const { return RequestQueue.Num(); }
+
+	// Non-pausing sequences that run alongside the story cinematic and each other
+	UFUNCTION(BlueprintCallable, Category="Cinematics|Ambient")
+	bool PlayAmbientCinematic(FName CinematicName, bool bSkippable = true, float PreDelay = 0.f, float PostDelay = 0.f,
+		ETLDCinematicQueuePolicy Policy = ETLDCinematicQueuePolicy::DropIfBusy, const AActor* SourceActor = nullptr);
+
+	// Honours the slot's bSkippable; returns false when nothing skippable by that name is playing
+	UFUNCTION(BlueprintCallable, Category="Cinematics|Ambient")
+	bool SkipAmbientCinematic(FName CinematicName);
+
+	UFUNCTION(BlueprintCallable, Category="Cinematics|Ambient")
+	void StopAllAmbientCinematics();
+
+	UFUNCTION(BlueprintPure, Category="Cinematics|Ambient")
+	int32 GetActiveAmbientCount() const { return AmbientSlots.Num(); }
+
+	UPROPERTY(BlueprintAssignable, Category="Cinematics")
+	FTLDOnCinematicResolved OnCinematicResolved;
+
+	// Client: called by ATLDCinematicReplicator whenever the server's cinematic changes
+	void ApplyReplicatedCinematic(const ATLDCinematicReplicator& Source);
+
+	// Server: skips for everyone once UTLDCinematicSettings::SkipVoteFraction of the players have voted for this serial
+	void RegisterSkipVote(APlayerController* Voter, uint8 Serial);
+
+private:
+	void StartSequence();
+	void ApplyPause(bool bPause);
+
+	// Per-world pool of sequence actors, rebound with SetSequence instead of respawned
+	ALevelSequenceActor* AcquirePooledActor(ULevelSequence* Sequence, const FMovieSceneSequencePlaybackSettings& Settings);
+	// bAllowPooling false destroys the actor so the player drops its sequence (played sections)
+	void ReturnActorToPool(ALevelSequenceActor* Actor, bool bAllowPooling = true);
+
+	// Unbinds now and, with bStopNow, stops the player so camera and input return this frame; pooling or destroying the actor
+	// and dropping the handle happen later in ProcessDeferredReleases
+	void ReleaseActorDeferred(ALevelSequenceActor* Actor, bool bAllowPooling, TSharedPtr<FStreamableHandle>&& LoadHandle, bool bStopNow = true);
+	void ProcessDeferredReleases();
+	void FlushDeferredReleases();
+
+	UFUNCTION()
+	void HandleSequenceFinished();
+	void SkipActiveRequest();
+
+	// Request queue
+	void BeginRequest(FTLDCinematicRequest&& Request);
+	bool EnqueueRequest(FTLDCinematicRequest&& Request);
+	void DispatchNextRequest();
+	void PrefetchQueueHead();
+	void BroadcastRequestComplete(FTLDCinematicRequest& Request, bool bStarted);
+	void ResetActivePlayback();
+	void AbortActiveRequest();
+	void FinishActiveRequest();
+
+	// Playlist handoff
+	bool HasNextPlaylistEntry() const;
+	void PrepareNextPlaylistEntry();
+	void OnNextConfigReady(uint32 Serial);
+	void OnNextSequenceLoaded(uint32 Serial);
+	void SkipNextPlaylistEntry();
+	void BindNextPlayer(ULevelSequence* Sequence);
+	void TryPlaylistHandoff();
+	void ReleaseNextPlayer();
+
+	// Ambient slots
+	bool StartAmbientRequest(FTLDCinematicRequest&& Request);
+	int32 FindAmbientSlot(uint32 Serial) const;
+	void OnAmbientConfigReady(uint32 Serial);
+	void OnAmbientSequenceLoaded(uint32 Serial);
+	void OnAmbientPreDelayElapsed(uint32 Serial);
+	void OnAmbientPostDelayElapsed(uint32 Serial);
+	void TryStartAmbientSlot(int32 SlotIndex);
+	void HandleAmbientFinished(uint32 Serial);
+	void EndAmbientSlot(int32 SlotIndex);
+	void UpdateAmbientThrottle();
+	void SetAmbientBucket(FTLDCinematicSlot& Slot, ULevelSequencePlayer& Player, ETLDCinematicEvalBucket Bucket, double Now);
+
+	// Async resolution
+	void RequestConfig(FSimpleDelegate&& OnReady);
+	void OnConfigLoaded();
+	// Builds on a worker for large configs; the game thread swaps the result in through OnConfigSnapshotBuilt
+	void PublishConfigSnapshot();
+	void OnAsyncSnapshotBuilt(TSharedRef<const FTLDCinematicConfigSnapshot> Snapshot, uint32 BuildSerial);
+	void OnConfigSnapshotBuilt(TSharedRef<const FTLDCinematicConfigSnapshot> Snapshot, uint32 BuildSerial);
+	bool IsSnapshotBuildInFlight() const { return bSnapshotRebuildScheduled || SnapshotBuildSerial != PublishedSnapshotSerial; }
+
+	// Shard mounts and unmounts arrive in bursts while cells stream; they share one rebuild on the next frame
+	void ScheduleConfigSnapshotRebuild();
+	void RunScheduledSnapshotRebuild();
+	void FlushConfigWaiters();
+	bool IsConfigLoadInFlight() const;
+
+	// Sequence path plus the entry's preload manifest when the manifest was generated for that sequence
+	TArray<FSoftObjectPath> MakeLoadPaths(const TSoftObjectPtr<ULevelSequence>& Sequence, FName CinematicName, bool bStartSequence) const;
+	// Manifest byte size for the resident cache; 0 lets the cache estimate
+	int64 GetCacheSizeHint(FName CinematicName) const;
+	// Caches a freshly loaded sequence together with a hold on its preload manifest
+	void AddToSequenceCache(FName CinematicName, ULevelSequence* Sequence);
+
+	// Networking
+	bool IsNetServer() const;
+	bool IsNetClient() const;
+	double GetServerWorldTime() const;
+	void PublishReplicatedRequest(FTLDCinematicRequest& Request);
+	void EndReplicatedRequest(bool bStopClients);
+	void AlignToNetStartTime();
+	void OnGameModePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer);
+	void OnGameStateSet(AGameStateBase* GameState);
+
+	// Stats
+	void RecordStartLatency(const FTLDCinematicRequest& Request);
+	void UpdateLiveStats() const;
+
+	// Config shards
+	void OnShardLoaded(FSoftObjectPath ShardPath);
+	void OnWorldInitializedActors(const FActorsInitializedParams& Params);
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+	bool IsOwnWorld(const UWorld* World) const;
+	void OnPendingConfigReady(uint32 Serial);
+	void OnPendingSequenceLoaded(uint32 Serial);
+	void OnPendingLoadDone();
+	void CompletePendingRequest(bool bStarted);
+
+	// Playback state machine
+	void SetPlaybackState(ETLDCinematicPlaybackState NewState);
+	bool IsPendingRequestActive() const;
+	void StartPlaybackTimer(float Delay);
+	bool IsPlaybackTimerPending() const;
+	void OnPlaybackTimer();
+
+	// Prefetching
+	void OnPrefetchConfigReady(FName CinematicName);
+	void OnPrefetchLoaded(FName CinematicName);
+
+	UPROPERTY(Transient)
+	ULevelSequence* PendingSequence = nullptr;
+
+	UPROPERTY(Transient)
+	ULevelSequencePlayer* ActivePlayer = nullptr;
+
+	UPROPERTY(Transient)
+	ALevelSequenceActor* ActiveActor = nullptr;
+
+	// Idle players keep their last sequence referenced until rebound, so the pool is kept small and
+	// actors are destroyed instead of pooled when that sequence has to be collected (PostDelay GC, eviction)
+	UPROPERTY(Transient)
+	TArray<ALevelSequenceActor*> ActorPool;
+
+	// Oldest first; AcquirePooledActor takes poolable actors from here before spawning
+	UPROPERTY(Transient)
+	TArray<FTLDCinematicDeferredRelease> DeferredReleases;
+
+	// Server: lazily spawned in the game world the first time a story cinematic is replicated
+	UPROPERTY(Transient)
+	ATLDCinematicReplicator* Replicator = nullptr;
+
+	TArray<TWeakObjectPtr<APlayerController>> SkipVoters;
+
+	// Client: last replicated serial turned into a request, so repeated OnReps do not restart it.
+	// Serials restart with every world's replicator, so the pair is only compared against the same replicator.
+	TWeakObjectPtr<const ATLDCinematicReplicator> LastAppliedReplicator;
+	uint8 LastAppliedNetSerial = 0;
+
+	// Client: a replicator that arrived before the GameState has no server clock to align to yet
+	TWeakObjectPtr<const ATLDCinematicReplicator> DeferredReplicator;
+	FDelegateHandle GameStateSetHandle;
+
+	FTimerHandle DeferredReleaseHandle;
+	bool bCollectGarbageWhenDrained = false;
+
+	// Loaded once at Initialize and referenced for the game instance's lifetime; readers use ConfigSnapshot
+	UPROPERTY(Transient)
+	UTLDCinematicConfig* LoadedConfig = nullptr;
+
+	// Replaced whole on the game thread, so lookups never lock; the previous snapshot serves until then
+	TSharedPtr<const FTLDCinematicConfigSnapshot> ConfigSnapshot;
+
+	// Configs read by in-flight index builds, kept from GC until every build has reported back to the game thread
+	UPROPERTY(Transient)
+	TArray<UTLDCinematicConfig*> SnapshotBuildConfigs;
+
+	TArray<UE::Tasks::FTask> SnapshotBuildTasks;
+	uint32 SnapshotBuildSerial = 0;
+	uint32 PublishedSnapshotSerial = 0;
+	// Worker builds whose game-thread completion has not run yet
+	int32 SnapshotBuildsInFlight = 0;
+	bool bSnapshotRebuildScheduled = false;
+	bool bDeinitialized = false;
+
+	// Mounted shards hold their config through the streamable handle; the snapshot is rebuilt on every change
+	struct FMountedShard
+	{
+		FName LevelPackage;
+		FSoftObjectPath ShardPath;
+		TSharedPtr<FStreamableHandle> Handle;
+		bool bLoading = false;
+	};
+	TArray<FMountedShard> MountedShards;
+	int32 PendingShardLoads = 0;
+
+	FDelegateHandle WorldInitializedActorsHandle;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle PostLoginHandle;
+
+	// Requests that had to wait for the startup load, reported once it completes
+	int32 EarlyConfigRequests = 0;
+
+#if TLD_CINEMATIC_LATENCY_TRACKING
+	struct FStartLatency
+	{
+		uint32 Count = 0;
+		double LastMs = 0.0;
+		double MinMs = MAX_dbl;
+		double MaxMs = 0.0;
+		double TotalMs = 0.0;
+		double TotalLoadMs = 0.0;
+	};
+	TMap<FName, FStartLatency> StartLatencies;
+#endif
+
+	// Recently played and prefetched sequences, LRU-evicted against UTLDCinematicSettings::ResidentCacheBudgetMB
+	UPROPERTY(Transient)
+	FTLDCinematicSequenceCache SequenceCache;
+
+	// Next playlist clip, bound to its sequence and stopped at the start until the current clip finishes
+	UPROPERTY(Transient)
+	ALevelSequenceActor* NextActor = nullptr;
+
+	// The request being loaded, delayed or played; valid while IsPlaying()
+	UPROPERTY(Transient)
+	FTLDCinematicRequest ActiveRequest;
+
+	// Waiting requests, highest priority first, bounded by UTLDCinematicSettings::MaxQueuedRequests
+	UPROPERTY(Transient)
+	TArray<FTLDCinematicRequest> RequestQueue;
+
+	// Ambient playbacks in start order, bounded by UTLDCinematicSettings::MaxAmbientCinematics
+	UPROPERTY(Transient)
+	TArray<FTLDCinematicSlot> AmbientSlots;
+
+	// One-shot triggers that have fired, by TriggerId. Only fired IDs are stored, so this is also exactly what gets saved.
+	TSet<FGuid> FiredTriggerIds;
+
+	// Queue head currently held through PrefetchCinematic
+	FName QueuedPrefetchName;
+	uint32 RequestSerialCounter = 0;
+
+	TSharedPtr<FStreamableHandle> ConfigLoadHandle;
+	TArray<FSimpleDelegate> ConfigWaiters;
+
+	// Held until the clip it loaded stops playing, so its preload manifest stays resident
+	TSharedPtr<FStreamableHandle> PendingLoadHandle;
+	TSoftObjectPtr<ULevelSequence> PendingSoftSequence;
+
+	TSharedPtr<FStreamableHandle> NextLoadHandle;
+	TSoftObjectPtr<ULevelSequence> NextSoftSequence;
+	// Current clip finished before the next one was ready; the handoff happens as soon as it binds
+	bool bAwaitingHandoff = false;
+
+	struct FPrefetchRecord
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<TWeakObjectPtr<const UObject>> Requesters;
+	};
+	TMap<FName, FPrefetchRecord> Prefetches;
+
+#if TLD_CINEMATIC_RUNTIME_VALIDATION
+	void FlushNameValidation();
+	void RunNameValidation();
+
+	struct FPendingNameValidation
+	{
+		TWeakObjectPtr<const AActor> Trigger;
+		FName CinematicName;
+	};
+	TArray<FPendingNameValidation> PendingNameValidations;
+	bool bNameValidationScheduled = false;
+#endif
+
+	// One countdown for both PreDelay and PostDelay, always bound to OnPlaybackTimer; OnPlaybackTimer reads PlaybackState
+	FTimerHandle PlaybackTimerHandle;
+	FTimerHandle AmbientThrottleHandle;
+
+	ETLDCinematicPlaybackState PlaybackState = ETLDCinematicPlaybackState::Idle;
+	bool bAllowSkip = false;
+};
@@ -0,0 +1,33 @@
+﻿// TLDCinematicNetComponent.cpp
+#include "UI/TLDCinematicNetComponent.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "UI/TLDCinematicManager.h"
+
+UTLDCinematicNetComponent::UTLDCinematicNetComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+UTLDCinematicNetComponent* UTLDCinematicNetComponent::FindOrAdd(APlayerController& PlayerController)
+{
+	if (UTLDCinematicNetComponent* Existing = PlayerController.FindComponentByClass<UTLDCinematicNetComponent>())
+	{
+		return Existing;
+	}
+
+	UTLDCinematicNetComponent* Component = NewObject<UTLDCinematicNetComponent>(&PlayerController, NAME_None, RF_Transient);
+	Component->RegisterComponent();
+	return Component;
+}
+
+void UTLDCinematicNetComponent::ServerVoteSkip_Implementation(uint8 Serial)
+{
+	APlayerController* PlayerController = GetOwner<APlayerController>();
+	const UGameInstance* GameInstance = PlayerController ? PlayerController->GetGameInstance() : nullptr;
+	if (UTLDCinematicManager* Manager = GameInstance ? GameInstance->GetSubsystem<UTLDCinematicManager>() : nullptr)
+	{
+		Manager->RegisterSkipVote(PlayerController, Serial);
+	}
+}
@@ -0,0 +1,25 @@
+// TLDCinematicNetComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "TLDCinematicNetComponent.generated.h"
+
+class APlayerController;
+
+// Added to every player controller by the server's UTLDCinematicManager; carries skip votes over the owning connection
+UCLASS(ClassGroup=(Cinematics), Transient)
+class THELASTDROP_API UTLDCinematicNetComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UTLDCinematicNetComponent();
+
+	// Server only; the component replicates to the owning client
+	static UTLDCinematicNetComponent* FindOrAdd(APlayerController& PlayerController);
+
+	// Serial of the replicated cinematic being voted on, so a vote arriving after the next one started is ignored
+	UFUNCTION(Server, Reliable)
+	void ServerVoteSkip(uint8 Serial);
+};
@@ -0,0 +1,81 @@
+﻿// TLDCinematicReplicator.cpp
+#include "UI/TLDCinematicReplicator.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+#include "UI/TLDCinematicManager.h"
+
+ATLDCinematicReplicator::ATLDCinematicReplicator()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	SetReplicatingMovement(false);
+
+	// Changes a few times per cinematic; every change is pushed with ForceNetUpdate
+	NetUpdateFrequency = 1.f;
+}
+
+void ATLDCinematicReplicator::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ATLDCinematicReplicator, Cinematic);
+	DOREPLIFETIME(ATLDCinematicReplicator, SkipVotes);
+	DOREPLIFETIME(ATLDCinematicReplicator, SkipVotesRequired);
+}
+
+uint8 ATLDCinematicReplicator::PublishCinematic(FName CinematicId, int32 IndexHint, double StartServerTime, bool bSkippable)
+{
+	const uint8 Serial = Cinematic.Serial == MAX_uint8 ? 1 : static_cast<uint8>(Cinematic.Serial + 1);
+
+	Cinematic = FTLDReplicatedCinematic();
+	Cinematic.CinematicId = CinematicId;
+	Cinematic.IndexHint = IndexHint;
+	Cinematic.StartServerTime = StartServerTime;
+	Cinematic.Serial = Serial;
+	Cinematic.bSkippable = bSkippable;
+	SkipVotes = 0;
+	ForceNetUpdate();
+	return Serial;
+}
+
+void ATLDCinematicReplicator::SetSkipVotes(int32 Votes, int32 Required)
+{
+	SkipVotes = static_cast<uint8>(FMath::Clamp(Votes, 0, MAX_uint8));
+	SkipVotesRequired = static_cast<uint8>(FMath::Clamp(Required, 0, MAX_uint8));
+	ForceNetUpdate();
+}
+
+void ATLDCinematicReplicator::StopCinematic(uint8 Serial)
+{
+	if (Cinematic.Serial == Serial && !Cinematic.CinematicId.IsNone())
+	{
+		Cinematic.bStopped = true;
+		ForceNetUpdate();
+	}
+}
+
+void ATLDCinematicReplicator::ClearCinematic(uint8 Serial)
+{
+	// The serial stays, so late joiners do not start a cinematic that already ended
+	if (Cinematic.Serial == Serial && !Cinematic.CinematicId.IsNone())
+	{
+		Cinematic.CinematicId = NAME_None;
+		ForceNetUpdate();
+	}
+}
+
+void ATLDCinematicReplicator::OnRep_Cinematic()
+{
+	if (UTLDCinematicManager* Manager = GetManager())
+	{
+		Manager->ApplyReplicatedCinematic(*this);
+	}
+}
+
+UTLDCinematicManager* ATLDCinematicReplicator::GetManager() const
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	return GameInstance ? GameInstance->GetSubsystem<UTLDCinematicManager>() : nullptr;
+}
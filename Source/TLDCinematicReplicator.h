@@ -0,0 +1,80 @@
+// TLDCinematicReplicator.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "TLDCinematicReplicator.generated.h"
+
+class UTLDCinematicManager;
+
+// All a client needs to play the server's story cinematic itself: the config ID and when frame 0 plays.
+// Sequences resolve and stream through each client's own manager and cache; there is no per-frame sync.
+USTRUCT()
+struct FTLDReplicatedCinematic
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName CinematicId;
+
+	// Server's snapshot index; a hint only, since shard mount order can differ between machines
+	UPROPERTY()
+	int32 IndexHint = INDEX_NONE;
+
+	// AGameStateBase::GetServerWorldTimeSeconds at which the sequence starts
+	UPROPERTY()
+	double StartServerTime = 0.0;
+
+	// Bumped for every published cinematic, wrapping past 0; 0 means nothing was published yet
+	UPROPERTY()
+	uint8 Serial = 0;
+
+	UPROPERTY()
+	bool bSkippable = true;
+
+	// Skip vote passed or the server abandoned it; clients stop as soon as they see it
+	UPROPERTY()
+	bool bStopped = false;
+};
+
+// Server-spawned, always relevant channel for UTLDCinematicManager's story playback. One per game world;
+// triggers never replicate themselves.
+UCLASS(NotPlaceable, Transient)
+class THELASTDROP_API ATLDCinematicReplicator : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ATLDCinematicReplicator();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Server only
+	uint8 PublishCinematic(FName CinematicId, int32 IndexHint, double StartServerTime, bool bSkippable);
+	void SetSkipVotes(int32 Votes, int32 Required);
+	void StopCinematic(uint8 Serial);
+	void ClearCinematic(uint8 Serial);
+
+	const FTLDReplicatedCinematic& GetCinematic() const { return Cinematic; }
+
+	UFUNCTION(BlueprintPure, Category="Cinematics|Network")
+	int32 GetSkipVotes() const { return SkipVotes; }
+
+	UFUNCTION(BlueprintPure, Category="Cinematics|Network")
+	int32 GetSkipVotesRequired() const { return SkipVotesRequired; }
+
+private:
+	UFUNCTION()
+	void OnRep_Cinematic();
+
+	UTLDCinematicManager* GetManager() const;
+
+	UPROPERTY(ReplicatedUsing=OnRep_Cinematic)
+	FTLDReplicatedCinematic Cinematic;
+
+	UPROPERTY(Replicated)
+	uint8 SkipVotes = 0;
+
+	UPROPERTY(Replicated)
+	uint8 SkipVotesRequired = 0;
+};
@@ -0,0 +1,98 @@
+// TLDCinematicSettings.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "Engine/EngineTypes.h"
+#include "UI/TLDCinematicTypes.h"
+#include "TLDCinematicSettings.generated.h"
+
+// Runtime tuning for the cinematic pipeline: Project Settings -> Game -> TLD Cinematics
+UCLASS(config=Game, defaultconfig, meta=(DisplayName="TLD Cinematics"))
+class THELASTDROP_API UTLDCinematicSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	static const UTLDCinematicSettings* Get() { return GetDefault<UTLDCinematicSettings>(); }
+
+	virtual FName GetCategoryName() const override { return TEXT("Game"); }
+
+	// Memory budget for sequences kept resident between plays. Pinned sequences may push past it.
+	UPROPERTY(config, EditAnywhere, Category="Streaming", meta=(ClampMin="0", Units="Megabytes"))
+	int32 ResidentCacheBudgetMB = 128;
+
+	// Idle ALevelSequenceActors kept per world for reuse. 0 spawns a fresh actor for every play.
+	UPROPERTY(config, EditAnywhere, Category="Playback", meta=(ClampMin="0", ClampMax="16"))
+	int32 MaxPooledSequenceActors = 2;
+
+	// Requests waiting behind the playing cinematic. When full, a new request only gets in by outranking the lowest queued one.
+	UPROPERTY(config, EditAnywhere, Category="Playback", meta=(ClampMin="0", ClampMax="32"))
+	int32 MaxQueuedRequests = 4;
+
+	// Ambient cinematics that may play at once next to the story cinematic. When full, Interrupt replaces the oldest; other policies drop.
+	UPROPERTY(config, EditAnywhere, Category="Playback", meta=(ClampMin="0", ClampMax="16"))
+	int32 MaxAmbientCinematics = 4;
+
+	// JumpToEnd restores pause and input on the skip frame and starts a queued, prefetched follow-up right away
+	UPROPERTY(config, EditAnywhere, Category="Playback")
+	ETLDCinematicSkipMode SkipMode = ETLDCinematicSkipMode::JumpToEnd;
+
+	// Object channel of the player pawn's collision, typically a "Player" channel added under Project Settings -> Collision.
+	// Triggers with bOnlyPlayerPawn overlap only this channel, so NPC pawns are rejected in the broadphase.
+	// Left at Pawn, triggers overlap every pawn and filter in IsValidInstigator.
+	UPROPERTY(config, EditAnywhere, Category="Triggers")
+	TEnumAsByte<ECollisionChannel> PlayerTriggerChannel = ECC_Pawn;
+
+	// Triggers stay dormant (no manager lookup, validation or collision) until a player pawn is this close to their bounds.
+	// Keeps World Partition cell streaming cheap. 0 activates every trigger at BeginPlay.
+	UPROPERTY(config, EditAnywhere, Category="Triggers", meta=(ClampMin="0.0", Units="cm"))
+	float TriggerActivationDistance = 0.f;
+
+	// Cell edge of the trigger spatial registry's uniform XY grid. Roughly the size of a typical trigger plus its prefetch radius.
+	UPROPERTY(config, EditAnywhere, Category="Triggers", meta=(ClampMin="100.0", Units="cm"))
+	float TriggerGridCellSize = 5000.f;
+
+	// Game-thread time per frame for returning and destroying sequence actors and releasing load handles after a cinematic.
+	// At least one release runs per frame. 0 tears everything down in the frame the cinematic ends.
+	UPROPERTY(config, EditAnywhere, Category="Cleanup", meta=(ClampMin="0.0", Units="Milliseconds"))
+	float CleanupBudgetMs = 1.f;
+
+	// Ask for an incremental GC once the deferred releases have drained, while PostDelay still holds gameplay back
+	UPROPERTY(config, EditAnywhere, Category="Cleanup")
+	bool bCollectGarbageDuringPostDelay = true;
+
+	// Story cinematics requested on a listen or dedicated server play on every client, aligned to server time.
+	// Story triggers do not fire on clients then; ambient cinematics stay local everywhere.
+	// Replicated cinematics never pause: a paused session freezes server time, which late joiners align to.
+	UPROPERTY(config, EditAnywhere, Category="Network")
+	bool bReplicateStoryCinematics = true;
+
+	// Added to the PreDelay of replicated cinematics, so clients can resolve and stream before the first frame
+	UPROPERTY(config, EditAnywhere, Category="Network", meta=(ClampMin="0.0", Units="Seconds", EditCondition="bReplicateStoryCinematics"))
+	float NetStartLeadTime = 0.3f;
+
+	// Share of connected players that must vote before a replicated cinematic is skipped for everyone
+	UPROPERTY(config, EditAnywhere, Category="Network", meta=(ClampMin="0.01", ClampMax="1.0", EditCondition="bReplicateStoryCinematics"))
+	float SkipVoteFraction = 1.f;
+
+	// Lower Sequencer evaluation for ambient cinematics that are far from or behind the camera
+	UPROPERTY(config, EditAnywhere, Category="Ambient")
+	bool bThrottleAmbientCinematics = true;
+
+	// How often ambient slots are re-bucketed, and the step size for the stepped bucket
+	UPROPERTY(config, EditAnywhere, Category="Ambient", meta=(ClampMin="0.05", Units="Seconds", EditCondition="bThrottleAmbientCinematics"))
+	float AmbientThrottleInterval = 0.25f;
+
+	// Inside this distance ambient cinematics evaluate every frame
+	UPROPERTY(config, EditAnywhere, Category="Ambient", meta=(ClampMin="0.0", Units="cm", EditCondition="bThrottleAmbientCinematics"))
+	float AmbientFullRateDistance = 3000.f;
+
+	// Beyond this distance ambient cinematics are paused; between the two they are stepped
+	UPROPERTY(config, EditAnywhere, Category="Ambient", meta=(ClampMin="0.0", Units="cm", EditCondition="bThrottleAmbientCinematics"))
+	float AmbientPauseDistance = 10000.f;
+
+	// Pause ambient cinematics outside the camera's view cone regardless of distance
+	UPROPERTY(config, EditAnywhere, Category="Ambient", meta=(EditCondition="bThrottleAmbientCinematics"))
+	bool bPauseOffscreenAmbient = true;
+};
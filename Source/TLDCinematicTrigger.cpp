@@ -3,17 +3,107 @@
 
 // Engine includes
 #include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "UObject/ObjectSaveContext.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
 
 // Project includes
 #include "UI/TLDCinematicManager.h"
 #include "UI/TLDCinematicConfig.h"
+#include "UI/TLDCinematicDiagnostics.h"
+#include "UI/TLDCinematicSettings.h"
+#include "UI/TLDCinematicTriggerSubsystem.h"
 #include "Utilities/TLDProjectSettings.h"
 
 // Logging
+// Per-trigger lines are Verbose/VeryVerbose and stripped from Shipping; only misconfiguration survives.
+#if UE_BUILD_SHIPPING
+DEFINE_LOG_CATEGORY_STATIC(LogTLDCinematicTrigger, Log, Warning);
+#else
 DEFINE_LOG_CATEGORY_STATIC(LogTLDCinematicTrigger, Log, All);
+#endif
+
+static TAutoConsoleVariable<float> CVarTLDTriggerLogInterval(
+    TEXT("tld.Cinematic.TriggerLogInterval"),
+    1.0f,
+    TEXT("Minimum seconds between overlap log lines from the same cinematic trigger."),
+    ECVF_Default);
+
+// Overlap-driven lines re-fire every time a pawn brushes the box, so they are throttled per actor
+#define TLD_TRIGGER_OVERLAP_LOG(Verbosity, Format, ...) \
+    do { if (bLogThisOverlap) { UE_LOG(LogTLDCinematicTrigger, Verbosity, Format, ##__VA_ARGS__); } } while (0)
+
+// ===============================
+// COUNTERS
+// ===============================
+
+namespace TLDCinematicTriggerStats
+{
+    enum class ECounter : uint8
+    {
+        OverlapEvents,
+        Fired,
+        RejectedAlreadyFired,
+        RejectedNullInstigator,
+        RejectedNotPawn,
+        RejectedNotPlayerControlled,
+        RejectedNoManager,
+        RejectedEmptyName,
+        SkippedPersistedFired,
+        Num
+    };
+
+    static const TCHAR* CounterNames[] =
+    {
+        TEXT("Overlaps"),
+        TEXT("Fired"),
+        TEXT("AlreadyFired"),
+        TEXT("NullInstigator"),
+        TEXT("NotPawn"),
+        TEXT("NotPlayer"),
+        TEXT("NoManager"),
+        TEXT("EmptyName"),
+        TEXT("PersistedFired"),
+    };
+    static_assert(UE_ARRAY_COUNT(CounterNames) == static_cast<int32>(ECounter::Num), "CounterNames out of sync with ECounter");
+
+    // Game-thread only
+    static uint32 Counters[static_cast<int32>(ECounter::Num)] = {};
+
+    static void Count(ECounter Counter)
+    {
+        ++Counters[static_cast<int32>(Counter)];
+    }
+
+    static void Dump(const TArray<FString>& Args)
+    {
+        FString Summary;
+        for (int32 Index = 0; Index < static_cast<int32>(ECounter::Num); ++Index)
+        {
+            Summary += FString::Printf(TEXT("%s=%u "), CounterNames[Index], Counters[Index]);
+        }
+        UE_LOG(LogTLDCinematicTrigger, Display, TEXT("Trigger stats: %s"), *Summary);
+
+        if (Args.Contains(TEXT("reset")))
+        {
+            FMemory::Memzero(Counters);
+        }
+    }
+
+    static FAutoConsoleCommand DumpCommand(
+        TEXT("tld.Cinematic.DumpTriggerStats"),
+        TEXT("Logs fire and reject counts for all cinematic triggers. Pass 'reset' to clear them afterwards."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Dump));
+}
+
+using TLDCinematicTriggerStats::ECounter;
 
 // ===============================
 // CONSTRUCTION
@@ -34,6 +124,29 @@ ATLDCinematicTrigger::ATLDCinematicTrigger()
     Box->OnComponentBeginOverlap.AddDynamic(this, &ATLDCinematicTrigger::OnBoxBeginOverlap);
 
     Box->SetBoxExtent(FVector(200.f, 200.f, 100.f));
+
+    PrefetchSphere = CreateDefaultSubobject<USphereComponent>(TEXT("PrefetchSphere"));
+    PrefetchSphere->SetupAttachment(Box);
+    PrefetchSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+    PrefetchSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+    PrefetchSphere->SetCollisionObjectType(ECC_WorldStatic);
+    PrefetchSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+    PrefetchSphere->OnComponentBeginOverlap.AddDynamic(this, &ATLDCinematicTrigger::OnPrefetchBeginOverlap);
+    PrefetchSphere->OnComponentEndOverlap.AddDynamic(this, &ATLDCinematicTrigger::OnPrefetchEndOverlap);
+}
+
+void ATLDCinematicTrigger::OnConstruction(const FTransform& Transform)
+{
+    Super::OnConstruction(Transform);
+    UpdateCollision();
+
+#if WITH_EDITOR
+    if (!TriggerId.IsValid() && !IsTemplate() && GetWorld() && !GetWorld()->IsGameWorld())
+    {
+        TriggerId = FGuid::NewGuid();
+    }
+#endif
 }
 
 // ===============================
@@ -44,26 +157,88 @@ void ATLDCinematicTrigger::BeginPlay()
 {
     Super::BeginPlay();
 
-    UE_LOG(LogTLDCinematicTrigger, Warning,
-        TEXT("[%s] BeginPlay - CinematicName='%s'  OneShot=%d  Pause=%d  Skip=%d  Pre=%.2f  Post=%.2f"),
-        *GetName(), *CinematicName, bOneShot, bPauseGame, bSkippable, PreDelay, PostDelay);
+    // A consumed one-shot streamed back in (or restored from a save) does no further work
+    if (bOneShot && TriggerId.IsValid())
+    {
+        const UGameInstance* GI = GetGameInstance();
+        const UTLDCinematicManager* Manager = GI ? GI->GetSubsystem<UTLDCinematicManager>() : nullptr;
+        if (Manager && Manager->HasTriggerFired(TriggerId))
+        {
+            TLDCinematicTriggerStats::Count(ECounter::SkippedPersistedFired);
+            bHasFired = true;
+            SetActorEnableCollision(false);
+            return;
+        }
+    }
+
+    // Streamed-in triggers only pay for a distance registration until the player gets close
+    const float ActivationDistance = UTLDCinematicSettings::Get()->TriggerActivationDistance;
+    UTLDCinematicTriggerSubsystem* Triggers = GetWorld()->GetSubsystem<UTLDCinematicTriggerSubsystem>();
+    if (ActivationDistance > 0.f && Triggers)
+    {
+        FVector Center;
+        FVector Extent;
+        GetTriggerBounds().GetCenterAndExtents(Center, Extent);
+        SetActorEnableCollision(false);
+        Triggers->RequestActivation(this, Center, ActivationDistance + FMath::Max(Extent.Size(), PrefetchRadius));
+        return;
+    }
+
+    ActivateTrigger();
+}
 
-    if (Box)
+void ATLDCinematicTrigger::ActivateTrigger()
+{
+    if (bActivated)
     {
-        UE_LOG(LogTLDCinematicTrigger, Warning,
-            TEXT("[%s] BoxExtent=%s  GenOverlap=%d"),
-            *GetName(), *Box->GetUnscaledBoxExtent().ToString(), Box->GetGenerateOverlapEvents());
+        return;
     }
+    bActivated = true;
+    SetActorEnableCollision(true);
+
+    UE_LOG(LogTLDCinematicTrigger, VeryVerbose,
+        TEXT("[%s] Activate - CinematicName='%s'  OneShot=%d  Pause=%d  Skip=%d  Pre=%.2f  Post=%.2f  BoxExtent=%s"),
+        *GetName(), *CinematicName, bOneShot, bPauseGame, bSkippable, PreDelay, PostDelay,
+        Box ? *Box->GetUnscaledBoxExtent().ToString() : TEXT("<none>"));
 
     // Resolve manager right away
     ResolveManager();
 
-    // Validate the cinematic name against config
-    ValidateCinematicName();
+#if TLD_CINEMATIC_RUNTIME_VALIDATION
+    // Batched per world by the manager; checks the config index without loading any sequence.
+    // Baked triggers were already validated when they were saved.
+    if (CachedManager && BakedCinematicId.IsNone())
+    {
+        CachedManager->QueueNameValidation(this, FName(*CinematicName));
+    }
+#endif
+
+    if (UTLDCinematicTriggerSubsystem* Triggers = GetWorld()->GetSubsystem<UTLDCinematicTriggerSubsystem>())
+    {
+        if (bUseSpatialRegistry)
+        {
+            // The grid's first test sees a player already inside as an entry, so no initial check is needed
+            UpdateCollision();
+            Triggers->RegisterSpatialTrigger(this);
+        }
+        else
+        {
+            // Handle case: player already inside trigger (swept once per frame for all new triggers)
+            Triggers->RequestInitialOverlapCheck(this);
+        }
+    }
+}
 
-    // Handle case: player already inside trigger
-    FTimerHandle Tmp;
-    GetWorld()->GetTimerManager().SetTimer(Tmp, this, &ATLDCinematicTrigger::CheckInitialOverlapOnce, 0.25f, false);
+void ATLDCinematicTrigger::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UTLDCinematicTriggerSubsystem* Triggers = GetWorld()->GetSubsystem<UTLDCinematicTriggerSubsystem>())
+    {
+        Triggers->CancelActivation(this);
+        Triggers->CancelInitialOverlapCheck(this);
+        Triggers->UnregisterSpatialTrigger(this);
+    }
+    ReleasePrefetch();
+    Super::EndPlay(EndPlayReason);
 }
 
 // ===============================
@@ -71,28 +246,172 @@ void ATLDCinematicTrigger::BeginPlay()
 // ===============================
 
 #if WITH_EDITOR
+void ATLDCinematicTrigger::GatherEditorConfigs(TArray<const UTLDCinematicConfig*>& OutConfigs) const
+{
+    const UTLDProjectSettings* PS = UTLDProjectSettings::Get();
+    OutConfigs.Add((PS && !PS->CinematicConfigAsset.IsNull()) ? PS->CinematicConfigAsset.LoadSynchronous() : nullptr);
+
+    const ULevel* Level = GetLevel();
+    if (!Level)
+    {
+        return;
+    }
+
+    TArray<FSoftObjectPath> Shards;
+    UTLDCinematicConfig::FindShardsForLevel(FName(*UWorld::RemovePIEPrefix(Level->GetOutermost()->GetName())), Shards);
+    for (const FSoftObjectPath& ShardPath : Shards)
+    {
+        if (const UTLDCinematicConfig* Shard = Cast<UTLDCinematicConfig>(ShardPath.TryLoad()))
+        {
+            OutConfigs.Add(Shard);
+        }
+    }
+}
+
 TArray<FString> ATLDCinematicTrigger::GetAvailableCinematics() const
 {
     TArray<FString> Options;
     Options.Add(""); // empty option
 
-    const UTLDProjectSettings* PS = UTLDProjectSettings::Get();
-    if (!PS || PS->CinematicConfigAsset.IsNull())
+    TArray<const UTLDCinematicConfig*> Configs;
+    GatherEditorConfigs(Configs);
+    if (Configs.Num() == 1 && !Configs[0])
     {
-        UE_LOG(LogTLDCinematicTrigger, Warning, TEXT("[Editor] No CinematicConfigAsset set in ProjectSettings"));
+        UE_LOG(LogTLDCinematicTrigger, Verbose, TEXT("[Editor] No CinematicConfigAsset set in ProjectSettings"));
         return Options;
     }
 
-    if (UTLDCinematicConfig* Config = PS->CinematicConfigAsset.LoadSynchronous())
+    for (const UTLDCinematicConfig* Config : Configs)
     {
+        if (!Config)
+        {
+            continue;
+        }
+
         for (const FTLDCinematicEntry& Entry : Config->Cinematics)
         {
-            Options.Add(Entry.CinematicName);
+            Options.AddUnique(Entry.CinematicName);
         }
     }
     return Options;
 }
+
+bool ATLDCinematicTrigger::BakeCinematicId()
+{
+    BakedCinematicId = NAME_None;
+    BakedCinematicIndex = INDEX_NONE;
+
+    if (CinematicName.IsEmpty())
+    {
+        return true;
+    }
+
+    TArray<const UTLDCinematicConfig*> Configs;
+    GatherEditorConfigs(Configs);
+
+    const FName Id(*CinematicName);
+    for (int32 ConfigIndex = 0; ConfigIndex < Configs.Num(); ++ConfigIndex)
+    {
+        const int32 Index = Configs[ConfigIndex] ? Configs[ConfigIndex]->FindEntryIndex(Id) : INDEX_NONE;
+        if (Index != INDEX_NONE)
+        {
+            // Shard indices shift with whatever else is mounted, so only root entries keep a hint
+            BakedCinematicId = Id;
+            BakedCinematicIndex = ConfigIndex == 0 ? Index : INDEX_NONE;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ATLDCinematicTrigger::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(ATLDCinematicTrigger, CinematicName))
+    {
+        BakeCinematicId();
+    }
+}
+
+EDataValidationResult ATLDCinematicTrigger::IsDataValid(FDataValidationContext& Context) const
+{
+    EDataValidationResult Result = Super::IsDataValid(Context);
+
+    if (CinematicName.IsEmpty())
+    {
+        Context.AddError(FText::FromString(FString::Printf(TEXT("%s: CinematicName is empty"), *GetName())));
+        return EDataValidationResult::Invalid;
+    }
+
+    TArray<const UTLDCinematicConfig*> Configs;
+    GatherEditorConfigs(Configs);
+    if (!Configs[0])
+    {
+        Context.AddError(FText::FromString(TEXT("No CinematicConfigAsset set in ProjectSettings")));
+        return EDataValidationResult::Invalid;
+    }
+
+    const FName Id(*CinematicName, FNAME_Find);
+    const bool bFound = Configs.ContainsByPredicate([Id](const UTLDCinematicConfig* Config)
+    {
+        return Config && Config->HasCinematic(Id);
+    });
+    if (!bFound)
+    {
+        Context.AddError(FText::FromString(FString::Printf(TEXT("%s: CinematicName '%s' is not in %s or this level's config shards"),
+            *GetName(), *CinematicName, *Configs[0]->GetName())));
+        return EDataValidationResult::Invalid;
+    }
+
+    return Result == EDataValidationResult::NotValidated ? EDataValidationResult::Valid : Result;
+}
+
+void ATLDCinematicTrigger::PostDuplicate(EDuplicateMode::Type DuplicateMode)
+{
+    Super::PostDuplicate(DuplicateMode);
+
+    // PIE copies keep the ID so runtime state matches the editor level; real duplicates are new triggers
+    if (DuplicateMode == EDuplicateMode::Normal)
+    {
+        TriggerId = FGuid::NewGuid();
+    }
+}
+
+void ATLDCinematicTrigger::PostEditImport()
+{
+    Super::PostEditImport();
+    TriggerId = FGuid::NewGuid();
+}
+#endif
+
+void ATLDCinematicTrigger::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+    Super::PreSave(ObjectSaveContext);
+
+#if WITH_EDITOR
+    if (!TriggerId.IsValid())
+    {
+        TriggerId = FGuid::NewGuid();
+    }
+
+    // Re-bake on every save so reordered configs refresh the index hint
+    if (!BakeCinematicId())
+    {
+        // Errors fail the cook, so an unknown name never reaches shipped content
+        if (ObjectSaveContext.IsCooking())
+        {
+            UE_LOG(LogTLDCinematicTrigger, Error,
+                TEXT("[%s] CinematicName '%s' NOT found in config. Re-select in editor."), *GetName(), *CinematicName);
+        }
+        else
+        {
+            UE_LOG(LogTLDCinematicTrigger, Warning,
+                TEXT("[%s] CinematicName '%s' NOT found in config. Re-select in editor."), *GetName(), *CinematicName);
+        }
+    }
 #endif
+}
 
 // ===============================
 // OVERLAP EVENTS
@@ -103,37 +422,88 @@ void ATLDCinematicTrigger::OnBoxBeginOverlap(
     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
     bool bFromSweep, const FHitResult& Sweep)
 {
-    UE_LOG(LogTLDCinematicTrigger, Warning,
+    TLDCinematicTriggerStats::Count(ECounter::OverlapEvents);
+    bLogThisOverlap = ShouldLogOverlap();
+
+    TLD_TRIGGER_OVERLAP_LOG(VeryVerbose,
         TEXT("[%s] OnBoxBeginOverlap fired by %s"), *GetName(),
         OtherActor ? *OtherActor->GetName() : TEXT("<null>"));
 
     if (bOneShot && bHasFired)
     {
-        UE_LOG(LogTLDCinematicTrigger, Warning,
+        TLDCinematicTriggerStats::Count(ECounter::RejectedAlreadyFired);
+        TLD_TRIGGER_OVERLAP_LOG(VeryVerbose,
             TEXT("[%s] Skipped - already fired (one-shot)"), *GetName());
         return;
     }
 
     if (!IsValidInstigator(OtherActor))
     {
-        UE_LOG(LogTLDCinematicTrigger, Warning,
-            TEXT("[%s] Skipped - invalid instigator"), *GetName());
         return;
     }
 
     if (!ResolveManager())
     {
+        TLDCinematicTriggerStats::Count(ECounter::RejectedNoManager);
         UE_LOG(LogTLDCinematicTrigger, Error,
             TEXT("[%s] No CinematicManager available"), *GetName());
         return;
     }
 
-    TriggerCinematic();
+    const bool bRequested = TriggerCinematic();
 
     if (bOneShot)
     {
         bHasFired = true;
+
+        // Saved state records only playback this machine requested; a client's replicated story fire belongs to the server
+        if (bRequested)
+        {
+            CachedManager->MarkTriggerFired(TriggerId);
+        }
+
+        // Playback holds its own reference from here; a consumed one-shot has nothing left to prefetch
+        ReleasePrefetch();
+    }
+}
+
+void ATLDCinematicTrigger::OnPrefetchBeginOverlap(
+    UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
+    bool bFromSweep, const FHitResult& Sweep)
+{
+    if (bHoldingPrefetch || (bOneShot && bHasFired) || CinematicName.IsEmpty())
+    {
+        return;
+    }
+
+    const APawn* Pawn = Cast<APawn>(OtherActor);
+    if (!Pawn || !Pawn->IsPlayerControlled() || !ResolveManager())
+    {
+        return;
     }
+
+    UE_LOG(LogTLDCinematicTrigger, Verbose,
+        TEXT("[%s] Player entered prefetch radius - streaming '%s'"), *GetName(), *CinematicName);
+
+    CachedManager->PrefetchCinematic(GetCinematicId(), this);
+    bHoldingPrefetch = true;
+}
+
+void ATLDCinematicTrigger::OnPrefetchEndOverlap(
+    UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+    const APawn* Pawn = Cast<APawn>(OtherActor);
+    if (!Pawn || !Pawn->IsPlayerControlled())
+    {
+        return;
+    }
+
+    UE_LOG(LogTLDCinematicTrigger, Verbose,
+        TEXT("[%s] Player left prefetch radius - releasing '%s'"), *GetName(), *CinematicName);
+
+    ReleasePrefetch();
 }
 
 // ===============================
@@ -149,7 +519,7 @@ UTLDCinematicManager* ATLDCinematicTrigger::ResolveManager()
         CachedManager = GI->GetSubsystem<UTLDCinematicManager>();
         if (CachedManager)
         {
-            UE_LOG(LogTLDCinematicTrigger, Warning,
+            UE_LOG(LogTLDCinematicTrigger, VeryVerbose,
                 TEXT("[%s] Resolved CinematicManager subsystem"), *GetName());
         }
         else
@@ -171,7 +541,8 @@ bool ATLDCinematicTrigger::IsValidInstigator(AActor* OtherActor) const
 {
     if (!OtherActor)
     {
-        UE_LOG(LogTLDCinematicTrigger, Warning, TEXT("[%s] Null instigator"), *GetName());
+        TLDCinematicTriggerStats::Count(ECounter::RejectedNullInstigator);
+        TLD_TRIGGER_OVERLAP_LOG(VeryVerbose, TEXT("[%s] Null instigator"), *GetName());
         return false;
     }
 
@@ -180,13 +551,15 @@ bool ATLDCinematicTrigger::IsValidInstigator(AActor* OtherActor) const
         APawn* Pawn = Cast<APawn>(OtherActor);
         if (!Pawn)
         {
-            UE_LOG(LogTLDCinematicTrigger, Warning,
+            TLDCinematicTriggerStats::Count(ECounter::RejectedNotPawn);
+            TLD_TRIGGER_OVERLAP_LOG(VeryVerbose,
                 TEXT("[%s] Instigator %s is not a Pawn"), *GetName(), *OtherActor->GetName());
             return false;
         }
         if (!Pawn->IsPlayerControlled())
         {
-            UE_LOG(LogTLDCinematicTrigger, Warning,
+            TLDCinematicTriggerStats::Count(ECounter::RejectedNotPlayerControlled);
+            TLD_TRIGGER_OVERLAP_LOG(VeryVerbose,
                 TEXT("[%s] Instigator %s is a Pawn but NOT player controlled"), *GetName(), *OtherActor->GetName());
             return false;
         }
@@ -194,87 +567,199 @@ bool ATLDCinematicTrigger::IsValidInstigator(AActor* OtherActor) const
     return true;
 }
 
-void ATLDCinematicTrigger::TriggerCinematic()
+bool ATLDCinematicTrigger::TriggerCinematic()
 {
     if (!CachedManager)
     {
         UE_LOG(LogTLDCinematicTrigger, Error,
             TEXT("[%s] TriggerCinematic but no manager"), *GetName());
-        return;
+        return false;
     }
 
     if (CinematicName.IsEmpty())
     {
+        TLDCinematicTriggerStats::Count(ECounter::RejectedEmptyName);
         UE_LOG(LogTLDCinematicTrigger, Error,
             TEXT("[%s] CinematicName is empty. Please select from dropdown."), *GetName());
-        return;
+        return false;
     }
 
-    UE_LOG(LogTLDCinematicTrigger, Warning,
+    // Networked story cinematics start on the server and reach clients through the manager's replicator
+    if (Layer == ETLDCinematicLayer::Story && GetNetMode() == NM_Client && UTLDCinematicSettings::Get()->bReplicateStoryCinematics)
+    {
+        UE_LOG(LogTLDCinematicTrigger, Verbose,
+            TEXT("[%s] Client - '%s' left to the server"), *GetName(), *CinematicName);
+        return false;
+    }
+
+    TLDCinematicTriggerStats::Count(ECounter::Fired);
+    UE_LOG(LogTLDCinematicTrigger, Verbose,
         TEXT("[%s] Requesting CinematicManager to play '%s'"), *GetName(), *CinematicName);
 
-    const bool bSuccess = CachedManager->PlayCinematicByName(
-        CinematicName, bPauseGame, bSkippable, PreDelay, PostDelay);
+#if !UE_BUILD_SHIPPING
+    if (bStressInert)
+    {
+        return true;
+    }
+#endif
 
-    if (bSuccess)
+    // Async: the sequence streams in behind PreDelay instead of blocking this overlap callback
+    FTLDCinematicRequest Request;
+    Request.CinematicName = GetCinematicId();
+    Request.IndexHint = BakedCinematicIndex;
+    Request.bPauseGame = bPauseGame;
+    Request.bSkippable = bSkippable;
+    Request.PreDelay = PreDelay;
+    Request.PostDelay = PostDelay;
+    Request.Policy = QueuePolicy;
+    Request.Priority = QueuePriority;
+    Request.Layer = Layer;
+    Request.SourceActor = this;
+    Request.OnComplete.Add(FTLDOnCinematicRequestComplete::CreateWeakLambda(this, [this](bool bStarted)
     {
-        UE_LOG(LogTLDCinematicTrigger, Warning,
-            TEXT("[%s] SUCCESS - Cinematic '%s' triggered"), *GetName(), *CinematicName);
+        if (bStarted)
+        {
+            UE_LOG(LogTLDCinematicTrigger, Verbose,
+                TEXT("[%s] SUCCESS - Cinematic '%s' triggered"), *GetName(), *CinematicName);
+        }
+        else
+        {
+            UE_LOG(LogTLDCinematicTrigger, Error,
+                TEXT("[%s] FAILED - Cinematic '%s' not found in config, dropped or interrupted"), *GetName(), *CinematicName);
+        }
+    }));
+    CachedManager->RequestCinematic(MoveTemp(Request));
+    return true;
+}
+
+FBox ATLDCinematicTrigger::GetTriggerBounds() const
+{
+    return Box ? Box->Bounds.GetBox() : FBox(ForceInit);
+}
+
+void ATLDCinematicTrigger::HandleInitialOverlap(APawn* PlayerPawn)
+{
+    if (Box && PlayerPawn && Box->IsOverlappingActor(PlayerPawn))
+    {
+        UE_LOG(LogTLDCinematicTrigger, Verbose,
+            TEXT("[%s] PlayerPawn is ALREADY inside trigger at BeginPlay. Auto-firing."), *GetName());
+        OnBoxBeginOverlap(Box, PlayerPawn, nullptr, 0, false, FHitResult());
     }
     else
     {
-        UE_LOG(LogTLDCinematicTrigger, Error,
-            TEXT("[%s] FAILED - Cinematic '%s' not found in config?"), *GetName(), *CinematicName);
+        UE_LOG(LogTLDCinematicTrigger, VeryVerbose,
+            TEXT("[%s] PlayerPawn NOT inside trigger at BeginPlay."), *GetName());
     }
 }
 
-void ATLDCinematicTrigger::CheckInitialOverlapOnce()
+void ATLDCinematicTrigger::HandleSpatialEnter(APawn* PlayerPawn)
+{
+    OnBoxBeginOverlap(Box, PlayerPawn, nullptr, 0, false, FHitResult());
+}
+
+void ATLDCinematicTrigger::HandleSpatialPrefetch(APawn* PlayerPawn, bool bInside)
 {
-    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
-    if (!PlayerPawn)
+    if (bInside)
     {
-        UE_LOG(LogTLDCinematicTrigger, Error,
-            TEXT("[%s] CheckInitialOverlapOnce: No PlayerPawn"), *GetName());
-        return;
+        OnPrefetchBeginOverlap(PrefetchSphere, PlayerPawn, nullptr, 0, false, FHitResult());
+    }
+    else if (bHoldingPrefetch)
+    {
+        UE_LOG(LogTLDCinematicTrigger, Verbose,
+            TEXT("[%s] Player left prefetch radius - releasing '%s'"), *GetName(), *CinematicName);
+        ReleasePrefetch();
     }
+}
+
+FName ATLDCinematicTrigger::GetCinematicId() const
+{
+    // Baked at save/cook time; unsaved or legacy triggers fall back to hashing the string
+    return BakedCinematicId.IsNone() ? FName(*CinematicName) : BakedCinematicId;
+}
 
-    if (Box && Box->IsOverlappingActor(PlayerPawn))
+bool ATLDCinematicTrigger::ShouldLogOverlap()
+{
+#if NO_LOGGING
+    return false;
+#else
+    // Every throttled line is VeryVerbose; at Verbose the interval would be spent on lines that never print
+    if (!UE_LOG_ACTIVE(LogTLDCinematicTrigger, VeryVerbose))
     {
-        UE_LOG(LogTLDCinematicTrigger, Warning,
-            TEXT("[%s] PlayerPawn is ALREADY inside trigger at BeginPlay. Auto-firing."), *GetName());
-        OnBoxBeginOverlap(Box, PlayerPawn, nullptr, 0, false, FHitResult());
+        return false;
     }
-    else
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now < NextOverlapLogTime)
     {
-        UE_LOG(LogTLDCinematicTrigger, Warning,
-            TEXT("[%s] PlayerPawn NOT inside trigger at BeginPlay."), *GetName());
+        return false;
     }
+
+    NextOverlapLogTime = Now + CVarTLDTriggerLogInterval.GetValueOnGameThread();
+    return true;
+#endif
 }
 
-void ATLDCinematicTrigger::ValidateCinematicName() const
+void ATLDCinematicTrigger::UpdateCollision()
 {
-    const UTLDProjectSettings* PS = UTLDProjectSettings::Get();
-    if (!PS || PS->CinematicConfigAsset.IsNull())
+    if (!Box || !PrefetchSphere)
     {
-        UE_LOG(LogTLDCinematicTrigger, Error,
-            TEXT("[%s] No CinematicConfigAsset set in ProjectSettings"), *GetName());
         return;
     }
 
-    if (UTLDCinematicConfig* Config = PS->CinematicConfigAsset.LoadSynchronous())
+    // Player-only triggers respond to the player's own object channel when the project defines one
+    const ECollisionChannel OverlapChannel = bOnlyPlayerPawn ? UTLDCinematicSettings::Get()->PlayerTriggerChannel.GetValue() : ECC_Pawn;
+    for (UPrimitiveComponent* Shape : { static_cast<UPrimitiveComponent*>(Box), static_cast<UPrimitiveComponent*>(PrefetchSphere) })
     {
-        const ULevelSequence* Seq = Config->GetSequenceByName(CinematicName);
-        if (Seq)
-        {
-            UE_LOG(LogTLDCinematicTrigger, Warning,
-                TEXT("[%s] CinematicName '%s' validated -> %s"),
-                *GetName(), *CinematicName, *Seq->GetName());
-        }
-        else
-        {
-            UE_LOG(LogTLDCinematicTrigger, Error,
-                TEXT("[%s] CinematicName '%s' NOT found in config. Re-select in editor."),
-                *GetName(), *CinematicName);
-        }
+        Shape->SetCollisionResponseToAllChannels(ECR_Ignore);
+        Shape->SetCollisionResponseToChannel(OverlapChannel, ECR_Overlap);
+    }
+
+    // Spatial registry triggers keep their shapes for bounds only; no physics body is created for them
+    Box->SetCollisionEnabled(bUseSpatialRegistry ? ECollisionEnabled::NoCollision : ECollisionEnabled::QueryOnly);
+    Box->SetGenerateOverlapEvents(!bUseSpatialRegistry);
+
+    const bool bPrefetchEnabled = PrefetchRadius > 0.f && !bUseSpatialRegistry;
+    PrefetchSphere->SetSphereRadius(FMath::Max(PrefetchRadius, 1.f));
+    PrefetchSphere->SetCollisionEnabled(bPrefetchEnabled ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
+    PrefetchSphere->SetGenerateOverlapEvents(bPrefetchEnabled);
+}
+
+void ATLDCinematicTrigger::ReleasePrefetch()
+{
+    if (!bHoldingPrefetch)
+    {
+        return;
     }
+
+    bHoldingPrefetch = false;
+    if (CachedManager)
+    {
+        CachedManager->ReleasePrefetch(GetCinematicId(), this);
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+// ===============================
+// STRESS HOOKS
+// ===============================
+
+void ATLDCinematicTrigger::ConfigureForStress(bool bSpatial)
+{
+    // Baked, so no name validation is queued
+    CinematicName = TEXT("TLDTriggerStress");
+    BakedCinematicId = TEXT("TLDTriggerStress");
+    bOneShot = false;
+    bUseSpatialRegistry = bSpatial;
+    bStressInert = true;
+}
+
+int32 ATLDCinematicTrigger::GetEnabledCollisionBodyCount() const
+{
+    return (Box && Box->IsCollisionEnabled() ? 1 : 0) + (PrefetchSphere && PrefetchSphere->IsCollisionEnabled() ? 1 : 0);
 }
+
+uint32 ATLDCinematicTrigger::GetOverlapEventCount()
+{
+    return TLDCinematicTriggerStats::Counters[static_cast<int32>(ECounter::OverlapEvents)];
+}
+#endif
@@ -0,0 +1,165 @@
+// TLDCinematicTrigger.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "UI/TLDCinematicTypes.h"
+#include "TLDCinematicTrigger.generated.h"
+
+class APawn;
+class UBoxComponent;
+class UPrimitiveComponent;
+class USphereComponent;
+class UTLDCinematicManager;
+
+UCLASS()
+class THELASTDROP_API ATLDCinematicTrigger : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ATLDCinematicTrigger();
+
+    virtual void OnConstruction(const FTransform& Transform) override;
+
+    // Called by UTLDCinematicTriggerSubsystem's batched sweep when the pawn's bounds touch this trigger
+    void HandleInitialOverlap(APawn* PlayerPawn);
+    FBox GetTriggerBounds() const;
+    float GetPrefetchRadius() const { return PrefetchRadius; }
+
+    // Per-trigger setup deferred from BeginPlay until a player is within TriggerActivationDistance
+    void ActivateTrigger();
+
+    // Called by UTLDCinematicTriggerSubsystem's grid test in place of the component overlap events
+    void HandleSpatialEnter(APawn* PlayerPawn);
+    void HandleSpatialPrefetch(APawn* PlayerPawn, bool bInside);
+
+#if !UE_BUILD_SHIPPING
+    // Hooks for tld.Cinematic.TriggerStress. Configure between a deferred SpawnActor and FinishSpawning;
+    // the trigger then overlaps and counts as usual but never requests its cinematic.
+    void ConfigureForStress(bool bSpatial);
+    int32 GetEnabledCollisionBodyCount() const;
+    static uint32 GetOverlapEventCount();
+#endif
+    virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+
+#if WITH_EDITOR
+    virtual void PostDuplicate(EDuplicateMode::Type DuplicateMode) override;
+    virtual void PostEditImport() override;
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Cinematic")
+    UBoxComponent* Box;
+
+    // Outer streaming volume; only generates overlaps when PrefetchRadius > 0
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Cinematic|Streaming")
+    USphereComponent* PrefetchSphere;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic", meta=(GetOptions="GetAvailableCinematics"))
+    FString CinematicName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic")
+    bool bPauseGame = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic")
+    bool bSkippable = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic", meta=(ClampMin="0.0"))
+    float PreDelay = 0.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic", meta=(ClampMin="0.0"))
+    float PostDelay = 0.f;
+
+    // Ambient triggers play alongside the story cinematic without pausing the game
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic|Queue")
+    ETLDCinematicLayer Layer = ETLDCinematicLayer::Story;
+
+    // What happens when another cinematic is already playing
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic|Queue")
+    ETLDCinematicQueuePolicy QueuePolicy = ETLDCinematicQueuePolicy::Enqueue;
+
+    // Higher plays first among queued requests
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic|Queue")
+    int32 QueuePriority = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic|Trigger")
+    bool bOneShot = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic|Trigger")
+    bool bOnlyPlayerPawn = true;
+
+    // Fire from the world's trigger grid instead of physics overlaps. Box and prefetch sphere get no collision;
+    // only player pawn locations are tested, so NPCs never reach this trigger.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic|Trigger")
+    bool bUseSpatialRegistry = false;
+
+    // Player entering this radius starts streaming the sequence; leaving it releases the handle. 0 disables prefetching.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cinematic|Streaming", meta=(ClampMin="0.0", Units="cm"))
+    float PrefetchRadius = 0.f;
+
+    // CinematicName resolved against the config at save/cook time; runtime plays through these without hashing the string
+    UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category="Cinematic")
+    FName BakedCinematicId;
+
+    UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category="Cinematic")
+    int32 BakedCinematicIndex = INDEX_NONE;
+
+    // Stable across sessions and cell reloads; keys this trigger's fired state in the manager's save data
+    UPROPERTY(VisibleAnywhere, AdvancedDisplay, Category="Cinematic|Trigger")
+    FGuid TriggerId;
+
+#if WITH_EDITOR
+    UFUNCTION()
+    TArray<FString> GetAvailableCinematics() const;
+
+    // Returns false when CinematicName is set but not present in the config
+    bool BakeCinematicId();
+
+    // Root config first (null when unset), then the shards mounted with this trigger's level
+    void GatherEditorConfigs(TArray<const UTLDCinematicConfig*>& OutConfigs) const;
+#endif
+
+private:
+    UFUNCTION()
+    void OnBoxBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+        UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& Sweep);
+
+    UFUNCTION()
+    void OnPrefetchBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+        UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& Sweep);
+
+    UFUNCTION()
+    void OnPrefetchEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+        UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+    UTLDCinematicManager* ResolveManager();
+    bool IsValidInstigator(AActor* OtherActor) const;
+    // False when nothing was requested: misconfigured, or a replicated story cinematic left to the server
+    bool TriggerCinematic();
+
+    FName GetCinematicId() const;
+    bool ShouldLogOverlap();
+    void UpdateCollision();
+    void ReleasePrefetch();
+
+    UPROPERTY(Transient)
+    UTLDCinematicManager* CachedManager = nullptr;
+
+    bool bHasFired = false;
+    bool bHoldingPrefetch = false;
+    bool bActivated = false;
+
+#if !UE_BUILD_SHIPPING
+    bool bStressInert = false;
+#endif
+
+    // Overlap lines are rate limited per actor by tld.Cinematic.TriggerLogInterval
+    double NextOverlapLogTime = 0.0;
+    bool bLogThisOverlap = false;
+};
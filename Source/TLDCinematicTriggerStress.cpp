@@ -0,0 +1,309 @@
+﻿// TLDCinematicTriggerStress.cpp
+#include "UI/TLDCinematicTrigger.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "GameFramework/DefaultPawn.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UI/TLDCinematicSettings.h"
+
+#if !UE_BUILD_SHIPPING
+
+DEFINE_LOG_CATEGORY_STATIC(LogTLDCinematicTriggerStress, Log, All);
+
+// Spawns a grid of triggers and a crowd of uncontrolled pawns walking through it, once per collision mode,
+// and reports spawn/BeginPlay cost, frame time, overlap callbacks and collision-enabled trigger bodies.
+class FTLDCinematicTriggerStress
+{
+public:
+    struct FResult
+    {
+        const TCHAR* Mode = TEXT("");
+        int32 Triggers = 0;
+        int32 Pawns = 0;
+        double SpawnMs = 0.0;
+        int32 Frames = 0;
+        double AvgFrameMs = 0.0;
+        double MaxFrameMs = 0.0;
+        uint32 OverlapEvents = 0;
+        int32 CollisionBodies = 0;
+    };
+
+    FTLDCinematicTriggerStress(UWorld& InWorld, const TArray<FString>& Args)
+        : World(&InWorld)
+    {
+        FString Mode = TEXT("both");
+        for (const FString& Arg : Args)
+        {
+            FParse::Value(*Arg, TEXT("triggers="), NumTriggers);
+            FParse::Value(*Arg, TEXT("pawns="), NumPawns);
+            FParse::Value(*Arg, TEXT("seconds="), Seconds);
+            FParse::Value(*Arg, TEXT("spacing="), Spacing);
+            FParse::Value(*Arg, TEXT("mode="), Mode);
+        }
+        NumTriggers = FMath::Clamp(NumTriggers, 1, 100000);
+        NumPawns = FMath::Clamp(NumPawns, 0, 10000);
+        Seconds = FMath::Max(Seconds, 1.f);
+
+        if (Mode != TEXT("spatial"))
+        {
+            Modes.Add(false);
+        }
+        if (Mode != TEXT("volume"))
+        {
+            Modes.Add(true);
+        }
+
+        const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(&InWorld, 0);
+        Origin = PlayerPawn ? PlayerPawn->GetActorLocation() : FVector::ZeroVector;
+    }
+
+    ~FTLDCinematicTriggerStress()
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        DestroySpawned();
+    }
+
+    void Start()
+    {
+        UE_LOG(LogTLDCinematicTriggerStress, Display, TEXT("Trigger stress: %d triggers, %d pawns, %.0fs per mode, activation distance %.0f, player channel %d"),
+            NumTriggers, NumPawns, Seconds, UTLDCinematicSettings::Get()->TriggerActivationDistance,
+            static_cast<int32>(UTLDCinematicSettings::Get()->PlayerTriggerChannel.GetValue()));
+        TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTLDCinematicTriggerStress::Tick));
+    }
+
+    bool IsRunning() const { return TickHandle.IsValid(); }
+
+private:
+    bool Tick(float DeltaTime)
+    {
+        UWorld* WorldPtr = World.Get();
+        if (!WorldPtr)
+        {
+            UE_LOG(LogTLDCinematicTriggerStress, Warning, TEXT("Trigger stress aborted: world went away"));
+            TickHandle.Reset();
+            return false;
+        }
+
+        if (!bModeRunning)
+        {
+            if (ModeIndex >= Modes.Num())
+            {
+                return Finish();
+            }
+            BeginMode(*WorldPtr, Modes[ModeIndex]);
+            return true;
+        }
+
+        // The spawn frame is not representative; measurement starts on the next one
+        if (bWarmedUp)
+        {
+            Current.Frames++;
+            Current.AvgFrameMs += DeltaTime * 1000.0;
+            Current.MaxFrameMs = FMath::Max(Current.MaxFrameMs, DeltaTime * 1000.0);
+            Elapsed += DeltaTime;
+        }
+        bWarmedUp = true;
+
+        MovePawns(DeltaTime);
+
+        if (Elapsed >= Seconds)
+        {
+            EndMode();
+        }
+        return true;
+    }
+
+    void BeginMode(UWorld& WorldRef, bool bSpatial)
+    {
+        Current = FResult();
+        Current.Mode = bSpatial ? TEXT("spatial") : TEXT("volume");
+        Current.Triggers = NumTriggers;
+        Current.Pawns = NumPawns;
+        Elapsed = 0.0;
+        bWarmedUp = false;
+
+        const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumTriggers)));
+        HalfSize = Side * Spacing * 0.5f;
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        SpawnParams.bDeferConstruction = true;
+
+        // Deferred so the mode is set before UpdateCollision runs; FinishSpawning covers construction, registration and BeginPlay
+        const double SpawnStart = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < NumTriggers; ++Index)
+        {
+            const FVector Location = Origin + FVector((Index % Side) * Spacing - HalfSize, (Index / Side) * Spacing - HalfSize, 0.f);
+            const FTransform Transform(Location);
+            ATLDCinematicTrigger* Trigger = WorldRef.SpawnActor<ATLDCinematicTrigger>(ATLDCinematicTrigger::StaticClass(), Transform, SpawnParams);
+            if (!Trigger)
+            {
+                continue;
+            }
+
+            // Inert: the player standing in the grid overlaps and gets counted, but no cinematic is requested
+            Trigger->ConfigureForStress(bSpatial);
+            Trigger->FinishSpawning(Transform);
+            SpawnedTriggers.Add(Trigger);
+        }
+        Current.SpawnMs = (FPlatformTime::Seconds() - SpawnStart) * 1000.0;
+
+        for (int32 Index = 0; Index < NumPawns; ++Index)
+        {
+            const FTransform PawnTransform(RandomPointInGrid());
+            if (APawn* Pawn = WorldRef.SpawnActor<APawn>(ADefaultPawn::StaticClass(), PawnTransform, SpawnParams))
+            {
+                Pawn->FinishSpawning(PawnTransform);
+                SpawnedPawns.Add(Pawn);
+                PawnTargets.Add(RandomPointInGrid());
+            }
+        }
+
+        OverlapsAtStart = ATLDCinematicTrigger::GetOverlapEventCount();
+        bModeRunning = true;
+    }
+
+    void MovePawns(float DeltaTime)
+    {
+        constexpr float WalkSpeed = 400.f;
+        for (int32 Index = 0; Index < SpawnedPawns.Num(); ++Index)
+        {
+            APawn* Pawn = SpawnedPawns[Index].Get();
+            if (!Pawn)
+            {
+                continue;
+            }
+
+            const FVector Location = Pawn->GetActorLocation();
+            const FVector ToTarget = PawnTargets[Index] - Location;
+            const float Step = WalkSpeed * DeltaTime;
+            if (ToTarget.SizeSquared() <= FMath::Square(Step))
+            {
+                PawnTargets[Index] = RandomPointInGrid();
+                continue;
+            }
+
+            // Unswept moves still run the overlap update, which is the per-trigger cost being measured
+            Pawn->SetActorLocation(Location + ToTarget.GetSafeNormal() * Step);
+        }
+    }
+
+    void EndMode()
+    {
+        Current.AvgFrameMs = Current.Frames > 0 ? Current.AvgFrameMs / Current.Frames : 0.0;
+        Current.OverlapEvents = ATLDCinematicTrigger::GetOverlapEventCount() - OverlapsAtStart;
+        for (const TWeakObjectPtr<ATLDCinematicTrigger>& Trigger : SpawnedTriggers)
+        {
+            if (const ATLDCinematicTrigger* TriggerPtr = Trigger.Get())
+            {
+                Current.CollisionBodies += TriggerPtr->GetEnabledCollisionBodyCount();
+            }
+        }
+
+        UE_LOG(LogTLDCinematicTriggerStress, Display, TEXT("Trigger stress [%s]: spawn+BeginPlay %.1f ms (%.1f us/trigger), frame avg %.2f max %.2f ms, %u overlaps, %d collision bodies"),
+            Current.Mode, Current.SpawnMs, Current.SpawnMs * 1000.0 / FMath::Max(1, Current.Triggers),
+            Current.AvgFrameMs, Current.MaxFrameMs, Current.OverlapEvents, Current.CollisionBodies);
+
+        Results.Add(Current);
+        DestroySpawned();
+        bModeRunning = false;
+        ++ModeIndex;
+    }
+
+    bool Finish()
+    {
+        TickHandle.Reset();
+
+        FString Csv = TEXT("Mode,Triggers,Pawns,SpawnMs,Frames,AvgFrameMs,MaxFrameMs,OverlapEvents,CollisionBodies\n");
+        for (const FResult& Result : Results)
+        {
+            Csv += FString::Printf(TEXT("%s,%d,%d,%.2f,%d,%.3f,%.3f,%u,%d\n"), Result.Mode, Result.Triggers, Result.Pawns,
+                Result.SpawnMs, Result.Frames, Result.AvgFrameMs, Result.MaxFrameMs, Result.OverlapEvents, Result.CollisionBodies);
+        }
+
+        const FString ReportPath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("TLDCinematics"),
+            FString::Printf(TEXT("TriggerStress-%s.csv"), *FDateTime::Now().ToString()));
+        IFileManager::Get().MakeDirectory(*FPaths::GetPath(ReportPath), true);
+        FFileHelper::SaveStringToFile(Csv, *ReportPath);
+        UE_LOG(LogTLDCinematicTriggerStress, Display, TEXT("Trigger stress: report written to %s"), *ReportPath);
+        return false;
+    }
+
+    void DestroySpawned()
+    {
+        for (const TWeakObjectPtr<APawn>& Pawn : SpawnedPawns)
+        {
+            if (APawn* PawnPtr = Pawn.Get())
+            {
+                PawnPtr->Destroy();
+            }
+        }
+        for (const TWeakObjectPtr<ATLDCinematicTrigger>& Trigger : SpawnedTriggers)
+        {
+            if (ATLDCinematicTrigger* TriggerPtr = Trigger.Get())
+            {
+                TriggerPtr->Destroy();
+            }
+        }
+        SpawnedPawns.Reset();
+        PawnTargets.Reset();
+        SpawnedTriggers.Reset();
+    }
+
+    FVector RandomPointInGrid() const
+    {
+        return Origin + FVector(FMath::FRandRange(-HalfSize, HalfSize), FMath::FRandRange(-HalfSize, HalfSize), 0.f);
+    }
+
+    TWeakObjectPtr<UWorld> World;
+    int32 NumTriggers = 1000;
+    int32 NumPawns = 100;
+    float Seconds = 10.f;
+    float Spacing = 600.f;
+    TArray<bool> Modes;
+
+    FVector Origin = FVector::ZeroVector;
+    float HalfSize = 0.f;
+    int32 ModeIndex = 0;
+    bool bModeRunning = false;
+    double Elapsed = 0.0;
+    bool bWarmedUp = false;
+    uint32 OverlapsAtStart = 0;
+    FResult Current;
+    TArray<FResult> Results;
+
+    TArray<TWeakObjectPtr<ATLDCinematicTrigger>> SpawnedTriggers;
+    TArray<TWeakObjectPtr<APawn>> SpawnedPawns;
+    TArray<FVector> PawnTargets;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
+
+static TUniquePtr<FTLDCinematicTriggerStress> GTLDCinematicTriggerStress;
+
+static FAutoConsoleCommandWithWorldAndArgs GTLDCinematicTriggerStressCommand(
+    TEXT("tld.Cinematic.TriggerStress"),
+    TEXT("Spawns a trigger grid around the player with pawns walking through it, per collision mode, and writes Saved/Profiling/TLDCinematics/TriggerStress-*.csv. ")
+    TEXT("Args: triggers=1000 pawns=100 seconds=10 spacing=600 mode=volume|spatial|both."),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (!World || !World->IsGameWorld())
+        {
+            UE_LOG(LogTLDCinematicTriggerStress, Error, TEXT("Trigger stress needs a game world"));
+            return;
+        }
+
+        if (GTLDCinematicTriggerStress && GTLDCinematicTriggerStress->IsRunning())
+        {
+            UE_LOG(LogTLDCinematicTriggerStress, Warning, TEXT("Trigger stress already running"));
+            return;
+        }
+
+        GTLDCinematicTriggerStress = MakeUnique<FTLDCinematicTriggerStress>(*World, Args);
+        GTLDCinematicTriggerStress->Start();
+    }));
+#endif
@@ -0,0 +1,389 @@
+﻿// TLDCinematicTriggerSubsystem.cpp
+#include "UI/TLDCinematicTriggerSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Math/VectorRegister.h"
+#include "UI/TLDCinematicSettings.h"
+#include "UI/TLDCinematicTrigger.h"
+
+void UTLDCinematicTriggerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	CellSize = UTLDCinematicSettings::Get()->TriggerGridCellSize;
+}
+
+void UTLDCinematicTriggerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Activations first: a trigger woken this tick queues its initial check or grid entry for the passes below
+	if (PendingActivations.Num() > 0)
+	{
+		UpdatePendingActivations();
+	}
+
+	if (PendingInitialChecks.Num() > 0)
+	{
+		SweepInitialOverlaps();
+	}
+
+	if (SpatialTriggers.Num() > 0)
+	{
+		UpdateSpatialTriggers();
+	}
+}
+
+TStatId UTLDCinematicTriggerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTLDCinematicTriggerSubsystem, STATGROUP_Tickables);
+}
+
+bool UTLDCinematicTriggerSubsystem::IsTickable() const
+{
+	return PendingInitialChecks.Num() > 0 || SpatialTriggers.Num() > 0 || PendingActivations.Num() > 0;
+}
+
+bool UTLDCinematicTriggerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTLDCinematicTriggerSubsystem::RequestInitialOverlapCheck(ATLDCinematicTrigger* Trigger)
+{
+	PendingInitialChecks.Add(Trigger);
+}
+
+void UTLDCinematicTriggerSubsystem::CancelInitialOverlapCheck(ATLDCinematicTrigger* Trigger)
+{
+	PendingInitialChecks.Remove(Trigger);
+}
+
+void UTLDCinematicTriggerSubsystem::SweepInitialOverlaps()
+{
+	// Every player, as in the activation and grid passes, so a listen or dedicated server catches clients spawned inside too
+	TArray<TPair<APawn*, FBox>, TInlineAllocator<4>> Pawns;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (APawn* Pawn = PC ? PC->GetPawn() : nullptr)
+		{
+			// One bounds computation per pawn for the whole batch; only AABB hits pay for the precise overlap test
+			Pawns.Emplace(Pawn, Pawn->GetComponentsBoundingBox());
+		}
+	}
+
+	// Drained even with no pawn (before login, spectators): a pawn spawned later gets its own begin-overlap
+	TSet<TWeakObjectPtr<ATLDCinematicTrigger>> Batch = MoveTemp(PendingInitialChecks);
+	for (const TWeakObjectPtr<ATLDCinematicTrigger>& WeakTrigger : Batch)
+	{
+		for (const TPair<APawn*, FBox>& Pawn : Pawns)
+		{
+			ATLDCinematicTrigger* Trigger = WeakTrigger.Get();
+			if (Trigger && Trigger->GetTriggerBounds().Intersect(Pawn.Value))
+			{
+				Trigger->HandleInitialOverlap(Pawn.Key);
+			}
+		}
+	}
+}
+
+void UTLDCinematicTriggerSubsystem::RequestActivation(ATLDCinematicTrigger* Trigger, const FVector& Center, float Radius)
+{
+	const FVector4f Sphere(FVector3f(Center), FMath::Square(Radius));
+	if (const int32* Existing = PendingActivationIndices.Find(Trigger))
+	{
+		PendingActivationSpheres[*Existing] = Sphere;
+		return;
+	}
+
+	PendingActivationIndices.Add(Trigger, PendingActivations.Add(Trigger));
+	PendingActivationSpheres.Add(Sphere);
+}
+
+void UTLDCinematicTriggerSubsystem::CancelActivation(ATLDCinematicTrigger* Trigger)
+{
+	if (const int32* Index = PendingActivationIndices.Find(Trigger))
+	{
+		RemovePendingActivationAt(*Index);
+	}
+}
+
+void UTLDCinematicTriggerSubsystem::RemovePendingActivationAt(int32 Index)
+{
+	// Keyed by the weak pointer itself so entries for already-destroyed triggers still resolve
+	PendingActivationIndices.Remove(PendingActivations[Index]);
+
+	const int32 LastIndex = PendingActivations.Num() - 1;
+	if (Index != LastIndex)
+	{
+		PendingActivationIndices.Add(PendingActivations[LastIndex], Index);
+	}
+	PendingActivations.RemoveAtSwap(Index);
+	PendingActivationSpheres.RemoveAtSwap(Index);
+}
+
+void UTLDCinematicTriggerSubsystem::UpdatePendingActivations()
+{
+	TArray<FVector3f, TInlineAllocator<4>> PlayerLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (const APawn* Pawn = PC ? PC->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(FVector3f(Pawn->GetActorLocation()));
+		}
+	}
+
+	if (PlayerLocations.Num() == 0)
+	{
+		return;
+	}
+
+	// Collected first: activation runs trigger code that may queue or cancel other activations
+	TArray<TWeakObjectPtr<ATLDCinematicTrigger>, TInlineAllocator<8>> Activated;
+	for (int32 Index = PendingActivations.Num() - 1; Index >= 0; --Index)
+	{
+		const FVector4f& Sphere = PendingActivationSpheres[Index];
+		const FVector3f Center(Sphere.X, Sphere.Y, Sphere.Z);
+		for (const FVector3f& Location : PlayerLocations)
+		{
+			if (FVector3f::DistSquared(Location, Center) <= Sphere.W)
+			{
+				Activated.Add(PendingActivations[Index]);
+				RemovePendingActivationAt(Index);
+				break;
+			}
+		}
+	}
+
+	for (const TWeakObjectPtr<ATLDCinematicTrigger>& WeakTrigger : Activated)
+	{
+		if (ATLDCinematicTrigger* Trigger = WeakTrigger.Get())
+		{
+			Trigger->ActivateTrigger();
+		}
+	}
+}
+
+void UTLDCinematicTriggerSubsystem::RegisterSpatialTrigger(ATLDCinematicTrigger* Trigger)
+{
+	if (!Trigger || SpatialTriggerIndices.Contains(Trigger))
+	{
+		return;
+	}
+
+	FSpatialTrigger Entry;
+	Entry.Trigger = Trigger;
+	Entry.TriggerBox = Trigger->GetTriggerBounds();
+	Entry.PrefetchCenter = Trigger->GetActorLocation();
+	Entry.PrefetchRadiusSq = FMath::Square(Trigger->GetPrefetchRadius());
+
+	// Grid entries use the outer shape so one lookup covers both the trigger box and the prefetch sphere
+	FBox OuterBounds = Entry.TriggerBox;
+	if (Entry.PrefetchRadiusSq > 0.f)
+	{
+		OuterBounds += FBox::BuildAABB(Entry.PrefetchCenter, FVector(Trigger->GetPrefetchRadius()));
+	}
+	Entry.MinCell = GetCell(OuterBounds.Min);
+	Entry.MaxCell = GetCell(OuterBounds.Max);
+
+	const int32 Index = SpatialTriggers.Add(Entry);
+	SpatialTriggerIndices.Add(Trigger, Index);
+	for (int32 CellY = Entry.MinCell.Y; CellY <= Entry.MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = Entry.MinCell.X; CellX <= Entry.MaxCell.X; ++CellX)
+		{
+			AddToCell(FIntPoint(CellX, CellY), Index, OuterBounds);
+		}
+	}
+}
+
+void UTLDCinematicTriggerSubsystem::UnregisterSpatialTrigger(ATLDCinematicTrigger* Trigger)
+{
+	int32 Index = INDEX_NONE;
+	if (!SpatialTriggerIndices.RemoveAndCopyValue(Trigger, Index))
+	{
+		return;
+	}
+
+	const FSpatialTrigger& Entry = SpatialTriggers[Index];
+	for (int32 CellY = Entry.MinCell.Y; CellY <= Entry.MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = Entry.MinCell.X; CellX <= Entry.MaxCell.X; ++CellX)
+		{
+			RemoveFromCell(FIntPoint(CellX, CellY), Index);
+		}
+	}
+	SpatialTriggers.RemoveAt(Index);
+	OccupiedSpatialTriggers.Remove(Index);
+}
+
+FIntPoint UTLDCinematicTriggerSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void UTLDCinematicTriggerSubsystem::AddToCell(const FIntPoint& CellKey, int32 TriggerIndex, const FBox& Bounds)
+{
+	FSpatialCell& Cell = SpatialCells.FindOrAdd(CellKey);
+	const int32 Slot = Cell.TriggerIndices.Add(TriggerIndex);
+	if (Slot >= Cell.MinX.Num())
+	{
+		// Grow by one SIMD lane group of empty boxes (min > max never contains a point)
+		for (TArray<float>* Mins : { &Cell.MinX, &Cell.MinY, &Cell.MinZ })
+		{
+			Mins->Append({ MAX_flt, MAX_flt, MAX_flt, MAX_flt });
+		}
+		for (TArray<float>* Maxs : { &Cell.MaxX, &Cell.MaxY, &Cell.MaxZ })
+		{
+			Maxs->Append({ -MAX_flt, -MAX_flt, -MAX_flt, -MAX_flt });
+		}
+	}
+
+	Cell.MinX[Slot] = Bounds.Min.X;
+	Cell.MinY[Slot] = Bounds.Min.Y;
+	Cell.MinZ[Slot] = Bounds.Min.Z;
+	Cell.MaxX[Slot] = Bounds.Max.X;
+	Cell.MaxY[Slot] = Bounds.Max.Y;
+	Cell.MaxZ[Slot] = Bounds.Max.Z;
+}
+
+void UTLDCinematicTriggerSubsystem::RemoveFromCell(const FIntPoint& CellKey, int32 TriggerIndex)
+{
+	FSpatialCell* Cell = SpatialCells.Find(CellKey);
+	const int32 Slot = Cell ? Cell->TriggerIndices.Find(TriggerIndex) : INDEX_NONE;
+	if (Slot == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Swap the last real entry into the hole, then blank the vacated lane
+	const int32 Last = Cell->TriggerIndices.Num() - 1;
+	Cell->TriggerIndices.RemoveAtSwap(Slot);
+	for (TArray<float>* Bounds : { &Cell->MinX, &Cell->MinY, &Cell->MinZ, &Cell->MaxX, &Cell->MaxY, &Cell->MaxZ })
+	{
+		(*Bounds)[Slot] = (*Bounds)[Last];
+	}
+	Cell->MinX[Last] = Cell->MinY[Last] = Cell->MinZ[Last] = MAX_flt;
+	Cell->MaxX[Last] = Cell->MaxY[Last] = Cell->MaxZ[Last] = -MAX_flt;
+
+	if (Cell->TriggerIndices.Num() == 0)
+	{
+		SpatialCells.Remove(CellKey);
+	}
+}
+
+void UTLDCinematicTriggerSubsystem::UpdateSpatialTriggers()
+{
+	TArray<APawn*, TInlineAllocator<4>> PlayerPawns;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (APawn* Pawn = PC ? PC->GetPawn() : nullptr)
+		{
+			PlayerPawns.Add(Pawn);
+		}
+	}
+
+	const int32 MaxIndex = SpatialTriggers.GetMaxIndex();
+	TBitArray<> InsideNow(false, MaxIndex);
+	TBitArray<> PrefetchNow(false, MaxIndex);
+	TArray<int32, TInlineAllocator<16>> OccupiedNow;
+	TArray<APawn*, TInlineAllocator<16>> OccupyingPawns;
+
+	for (APawn* Pawn : PlayerPawns)
+	{
+		const FVector Location = Pawn->GetActorLocation();
+		const FSpatialCell* Cell = SpatialCells.Find(GetCell(Location));
+		if (!Cell)
+		{
+			continue;
+		}
+
+		const VectorRegister4Float PX = VectorSetFloat1(static_cast<float>(Location.X));
+		const VectorRegister4Float PY = VectorSetFloat1(static_cast<float>(Location.Y));
+		const VectorRegister4Float PZ = VectorSetFloat1(static_cast<float>(Location.Z));
+
+		for (int32 Lane = 0; Lane < Cell->MinX.Num(); Lane += 4)
+		{
+			VectorRegister4Float Inside = VectorBitwiseAnd(
+				VectorCompareGE(PX, VectorLoad(&Cell->MinX[Lane])), VectorCompareLE(PX, VectorLoad(&Cell->MaxX[Lane])));
+			Inside = VectorBitwiseAnd(Inside, VectorBitwiseAnd(
+				VectorCompareGE(PY, VectorLoad(&Cell->MinY[Lane])), VectorCompareLE(PY, VectorLoad(&Cell->MaxY[Lane]))));
+			Inside = VectorBitwiseAnd(Inside, VectorBitwiseAnd(
+				VectorCompareGE(PZ, VectorLoad(&Cell->MinZ[Lane])), VectorCompareLE(PZ, VectorLoad(&Cell->MaxZ[Lane]))));
+
+			// Outer-box hits are refined against the exact trigger box and prefetch sphere
+			for (uint32 Mask = VectorMaskBits(Inside); Mask != 0; Mask &= Mask - 1)
+			{
+				const int32 Index = Cell->TriggerIndices[Lane + FMath::CountTrailingZeros(Mask)];
+				const FSpatialTrigger& Entry = SpatialTriggers[Index];
+				const bool bInside = Entry.TriggerBox.IsInsideOrOn(Location);
+				const bool bInPrefetch = Entry.PrefetchRadiusSq > 0.f && FVector::DistSquared(Location, Entry.PrefetchCenter) <= Entry.PrefetchRadiusSq;
+				if (!bInside && !bInPrefetch)
+				{
+					continue;
+				}
+
+				if (!InsideNow[Index] && !PrefetchNow[Index])
+				{
+					OccupiedNow.Add(Index);
+					OccupyingPawns.Add(Pawn);
+				}
+				InsideNow[Index] = InsideNow[Index] || bInside;
+				PrefetchNow[Index] = PrefetchNow[Index] || bInPrefetch;
+			}
+		}
+	}
+
+	// Exits first, so a trigger left and re-entered in one tick still sees both edges
+	TArray<int32> Previous = MoveTemp(OccupiedSpatialTriggers);
+	for (const int32 Index : Previous)
+	{
+		if (!SpatialTriggers.IsValidIndex(Index))
+		{
+			continue;
+		}
+
+		FSpatialTrigger& Entry = SpatialTriggers[Index];
+		const bool bStillInside = Index < MaxIndex && InsideNow[Index];
+		const bool bStillInPrefetch = Index < MaxIndex && PrefetchNow[Index];
+		Entry.bPawnInside = Entry.bPawnInside && bStillInside;
+		if (Entry.bPawnInPrefetch && !bStillInPrefetch)
+		{
+			Entry.bPawnInPrefetch = false;
+			if (ATLDCinematicTrigger* Trigger = Entry.Trigger.Get())
+			{
+				Trigger->HandleSpatialPrefetch(nullptr, false);
+			}
+		}
+	}
+
+	for (int32 Occupied = 0; Occupied < OccupiedNow.Num(); ++Occupied)
+	{
+		const int32 Index = OccupiedNow[Occupied];
+		if (!SpatialTriggers.IsValidIndex(Index))
+		{
+			continue;
+		}
+
+		FSpatialTrigger& Entry = SpatialTriggers[Index];
+		ATLDCinematicTrigger* Trigger = Entry.Trigger.Get();
+		const bool bEnteredPrefetch = PrefetchNow[Index] && !Entry.bPawnInPrefetch;
+		const bool bEntered = InsideNow[Index] && !Entry.bPawnInside;
+		Entry.bPawnInPrefetch = PrefetchNow[Index];
+		Entry.bPawnInside = InsideNow[Index];
+		OccupiedSpatialTriggers.Add(Index);
+
+		// Entry can be invalidated by the callbacks below (a trigger unregistering itself), so it is not touched after them
+		if (Trigger && bEnteredPrefetch)
+		{
+			Trigger->HandleSpatialPrefetch(OccupyingPawns[Occupied], true);
+		}
+		if (Trigger && bEntered)
+		{
+			Trigger->HandleSpatialEnter(OccupyingPawns[Occupied]);
+		}
+	}
+}
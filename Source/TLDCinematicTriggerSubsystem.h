@@ -0,0 +1,86 @@
+// TLDCinematicTriggerSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TLDCinematicTriggerSubsystem.generated.h"
+
+class APawn;
+class ATLDCinematicTrigger;
+
+// Per-world registry for cinematic triggers. Batches the "player already inside at BeginPlay" check
+// into one bounds query per player pawn per frame instead of a timer and overlap query per trigger.
+// Triggers with bUseSpatialRegistry skip physics overlaps entirely: their boxes live in a uniform grid
+// and only player pawn locations are tested against it, once per tick.
+UCLASS()
+class THELASTDROP_API UTLDCinematicTriggerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Queued triggers are swept against every player pawn on the next tick, then dropped
+	void RequestInitialOverlapCheck(ATLDCinematicTrigger* Trigger);
+	void CancelInitialOverlapCheck(ATLDCinematicTrigger* Trigger);
+
+	// Dormant triggers are activated once a player pawn comes within Radius of Center
+	void RequestActivation(ATLDCinematicTrigger* Trigger, const FVector& Center, float Radius);
+	void CancelActivation(ATLDCinematicTrigger* Trigger);
+
+	// Bounds are captured at registration; triggers are static
+	void RegisterSpatialTrigger(ATLDCinematicTrigger* Trigger);
+	void UnregisterSpatialTrigger(ATLDCinematicTrigger* Trigger);
+
+private:
+	void SweepInitialOverlaps();
+	void UpdatePendingActivations();
+	void RemovePendingActivationAt(int32 Index);
+	void UpdateSpatialTriggers();
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void AddToCell(const FIntPoint& CellKey, int32 TriggerIndex, const FBox& Bounds);
+	void RemoveFromCell(const FIntPoint& CellKey, int32 TriggerIndex);
+
+	// Hashed so queueing and cancelling stay O(1) when a streamed cell brings in hundreds of triggers at once
+	TSet<TWeakObjectPtr<ATLDCinematicTrigger>> PendingInitialChecks;
+
+	// Parallel arrays, swap-removed on activation; the distance pass only touches the packed spheres.
+	// PendingActivationIndices follows every swap so cancelling on EndPlay needs no search.
+	TArray<TWeakObjectPtr<ATLDCinematicTrigger>> PendingActivations;
+	TArray<FVector4f> PendingActivationSpheres;
+	TMap<TWeakObjectPtr<ATLDCinematicTrigger>, int32> PendingActivationIndices;
+
+	struct FSpatialTrigger
+	{
+		TWeakObjectPtr<ATLDCinematicTrigger> Trigger;
+		FBox TriggerBox;
+		FVector PrefetchCenter = FVector::ZeroVector;
+		float PrefetchRadiusSq = 0.f;
+		FIntPoint MinCell;
+		FIntPoint MaxCell;
+		bool bPawnInside = false;
+		bool bPawnInPrefetch = false;
+	};
+
+	// Struct of arrays so one SIMD compare tests a point against four boxes.
+	// Bounds arrays are padded to a multiple of four with empty boxes; TriggerIndices holds only real entries.
+	struct FSpatialCell
+	{
+		TArray<float> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+		TArray<int32> TriggerIndices;
+	};
+
+	TSparseArray<FSpatialTrigger> SpatialTriggers;
+	TMap<const ATLDCinematicTrigger*, int32> SpatialTriggerIndices;
+	TMap<FIntPoint, FSpatialCell> SpatialCells;
+
+	// Triggers a player was inside (or in prefetch range of) last tick; exits are found by diffing against it
+	TArray<int32> OccupiedSpatialTriggers;
+
+	float CellSize = 5000.f;
+};
@@ -0,0 +1,187 @@
+// TLDCinematicTypes.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "TLDCinematicTypes.generated.h"
+
+class ALevelSequenceActor;
+class ULevelSequence;
+struct FStreamableHandle;
+
+// Fired once per request: bStarted is false when the name could not be resolved, or the request was dropped
+DECLARE_DELEGATE_OneParam(FTLDOnCinematicRequestComplete, bool /*bStarted*/);
+
+// What a request does when another cinematic is already loading, delaying or playing
+UENUM(BlueprintType)
+enum class ETLDCinematicQueuePolicy : uint8
+{
+	// Stop the current cinematic and start this one now
+	Interrupt,
+	// Wait behind the current cinematic, ordered by priority
+	Enqueue,
+	// Ignore the request while busy
+	DropIfBusy
+};
+
+// Story cinematics are exclusive: one at a time, may pause and lock input. Ambient ones run side by side and never pause.
+UENUM(BlueprintType)
+enum class ETLDCinematicLayer : uint8
+{
+	Story,
+	Ambient
+};
+
+// How a skip leaves the skipped sequence
+UENUM(BlueprintType)
+enum class ETLDCinematicSkipMode : uint8
+{
+	// Stop where it is and run the normal finish, PostDelay included
+	Stop,
+	// Evaluate the last frame once so Keep State sections land, then finish in the same frame without PostDelay
+	JumpToEnd
+};
+
+USTRUCT()
+struct FTLDCinematicRequest
+{
+	GENERATED_BODY()
+
+	// Config name, or NAME_None when DirectSequence is set (PlaySequence)
+	FName CinematicName;
+	int32 IndexHint = INDEX_NONE;
+
+	// Playlist requests: every clip in order, with CinematicName tracking PlaylistNames[PlaylistIndex]
+	TArray<FName> PlaylistNames;
+	int32 PlaylistIndex = 0;
+
+	// Sectioned entries: the config's sections, parallel to PlaylistNames (all the entry's name). Never cached.
+	TArray<TSoftObjectPtr<ULevelSequence>> PlaylistSequences;
+
+	UPROPERTY(Transient)
+	ULevelSequence* DirectSequence = nullptr;
+
+	bool bPauseGame = true;
+	bool bSkippable = true;
+	float PreDelay = 0.f;
+	float PostDelay = 0.f;
+
+	ETLDCinematicQueuePolicy Policy = ETLDCinematicQueuePolicy::Enqueue;
+	int32 Priority = 0;
+
+	// Ambient requests ignore bPauseGame and PlaylistNames beyond the first clip
+	ETLDCinematicLayer Layer = ETLDCinematicLayer::Story;
+
+	// Where an ambient cinematic happens, for distance throttling; ambient requests without one always evaluate at full rate
+	TWeakObjectPtr<const AActor> SourceActor;
+
+	// Assigned by the manager; async callbacks carrying an older serial are ignored
+	uint32 Serial = 0;
+
+	// FPlatformTime::Seconds when the request was made (trigger fire, Blueprint call) and when its sequence stream began
+	double RequestTime = 0.0;
+	double LoadStartTime = 0.0;
+	float LoadMs = 0.f;
+
+	// Mirrored through ATLDCinematicReplicator: the replicator's serial (0 for local requests) and the
+	// server world time the sequence starts at, which late starters jump forward to
+	uint8 NetSerial = 0;
+	double NetStartServerTime = 0.0;
+
+	// More than one when duplicate names were coalesced in the queue
+	TArray<FTLDOnCinematicRequestComplete> OnComplete;
+};
+
+// How often an ambient slot's player evaluates, picked from camera distance and facing
+enum class ETLDCinematicEvalBucket : uint8
+{
+	// Ticked by Sequencer every frame
+	Full,
+	// Player paused and stepped forward by the manager at UTLDCinematicSettings::AmbientThrottleInterval
+	Stepped,
+	// Player paused; resumes from the same frame when relevant again
+	Paused
+};
+
+// Outcome of UTLDCinematicManager::EvictResidentCinematic
+enum class ETLDCinematicEvictResult : uint8
+{
+	// Dropped from the resident cache; the next play streams it again
+	Evicted,
+	// Was not in the cache, so the next play streams it anyway
+	NotResident,
+	// Kept resident by a prefetch, pin or playback; the next play will be a warm start
+	Held
+};
+
+// One ambient playback: its own request, delays, skip state and finish handling
+USTRUCT()
+struct FTLDCinematicSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	FTLDCinematicRequest Request;
+
+	UPROPERTY(Transient)
+	ULevelSequence* Sequence = nullptr;
+
+	UPROPERTY(Transient)
+	ALevelSequenceActor* Actor = nullptr;
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	TSoftObjectPtr<ULevelSequence> SoftSequence;
+	FTimerHandle PreDelayHandle;
+	FTimerHandle PostDelayHandle;
+	bool bLoadDone = false;
+	bool bPreDelayDone = false;
+	bool bStarted = false;
+
+	ETLDCinematicEvalBucket Bucket = ETLDCinematicEvalBucket::Full;
+	double LastStepTime = 0.0;
+};
+
+// Story playback phase of UTLDCinematicManager; every phase other than Idle counts as playing
+UENUM(BlueprintType)
+enum class ETLDCinematicPlaybackState : uint8
+{
+	Idle,
+
+	// Config resolving or sequence streaming; the PreDelay may still be counting down alongside
+	Loading,
+
+	// Sequence resident, waiting out the rest of the PreDelay
+	PreDelay,
+
+	// Includes a playlist waiting on its next clip to bind
+	Playing,
+
+	// Finished, holding pause and input until the PostDelay elapses
+	PostDelay,
+
+	// Tearing down; requests made from completion callbacks queue behind it, Interrupt included
+	Cleanup
+};
+
+// Teardown the manager spreads over frames after a cinematic ends, within UTLDCinematicSettings::CleanupBudgetMs
+USTRUCT()
+struct FTLDCinematicDeferredRelease
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	ALevelSequenceActor* Actor = nullptr;
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	bool bAllowPooling = true;
+};
+
+// Saved one-shot trigger state. Only fired triggers are written, as raw GUIDs, so it serializes as one block.
+USTRUCT(BlueprintType)
+struct FTLDCinematicTriggerSaveData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame)
+	TArray<FGuid> FiredTriggerIds;
+};